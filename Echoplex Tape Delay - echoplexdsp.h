@@ -0,0 +1,675 @@
+// -----------------------------------------------------------------------------
+//    Echoplex Tape Delay DSP helpers:  echoplexdsp.h
+//
+/**
+    \file   echoplexdsp.h
+    \brief  small real-time helpers used by the Echoplex PluginCore:
+    		- scoped flush-to-zero/denormals-are-zero control
+    		- per-block CPU profiling
+    		- block-rendered wow/flutter oscillator bank
+    		- varispeed tape loop with band-limited polyphase record/playback heads, head bleed and crosstalk
+*/
+// -----------------------------------------------------------------------------
+#ifndef __echoplexDSP_h__
+#define __echoplexDSP_h__
+
+#include <cstdint>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ECHOPLEX_SSE 1
+#else
+#define ECHOPLEX_SSE 0
+#endif
+
+/**
+\class ScopedDenormalFlush
+\brief
+Sets flush-to-zero (FTZ) and denormals-are-zero (DAZ) for the lifetime of the object and restores the
+previous floating point control state on destruction. Put one at the top of each processing entry point
+so that decaying feedback loops and IIR filters never reach subnormal values.
+
+- x86/x64: MXCSR bits 15 (FTZ) and 6 (DAZ)
+- AArch64: FPCR bit 24 (FZ)
+- other targets: no-op; rely on explicit flushing with checkFloatUnderflow( )
+*/
+class ScopedDenormalFlush
+{
+public:
+	ScopedDenormalFlush()
+	{
+#if ECHOPLEX_SSE
+		oldState = _mm_getcsr();
+		_mm_setcsr(oldState | 0x8040);
+#elif defined(__aarch64__)
+		uint64_t fpcr;
+		__asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+		oldState = fpcr;
+		__asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | (uint64_t(1) << 24)));
+#endif
+	}
+
+	~ScopedDenormalFlush()
+	{
+#if ECHOPLEX_SSE
+		_mm_setcsr(oldState);
+#elif defined(__aarch64__)
+		__asm__ __volatile__("msr fpcr, %0" : : "r"(oldState));
+#endif
+	}
+
+	ScopedDenormalFlush(const ScopedDenormalFlush&) = delete;
+	ScopedDenormalFlush& operator=(const ScopedDenormalFlush&) = delete;
+
+private:
+#if defined(__aarch64__) && !ECHOPLEX_SSE
+	uint64_t oldState = 0;
+#else
+	uint32_t oldState = 0;
+#endif
+};
+
+/**
+\class BlockProfiler
+\brief
+Measures the wall-clock time of each processed block and keeps the worst case, both in microseconds and
+as a fraction of the block's real-time budget (1.0 = the block took exactly as long as it lasts).
+*/
+class BlockProfiler
+{
+public:
+	/** clear the statistics */
+	void reset()
+	{
+		worstBlock_uSec = 0.0;
+		worstBlockLoad = 0.0;
+		lastBlock_uSec = 0.0;
+		blockCount = 0;
+	}
+
+	/** call at the top of the block */
+	void startBlock() { blockStart = std::chrono::steady_clock::now(); }
+
+	/** call at the end of the block */
+	void endBlock(uint32_t numFrames, double sampleRate)
+	{
+		std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - blockStart;
+		lastBlock_uSec = elapsed.count();
+
+		double budget_uSec = 1.0e6 * numFrames / sampleRate;
+		double load = budget_uSec > 0.0 ? lastBlock_uSec / budget_uSec : 0.0;
+
+		if (lastBlock_uSec > worstBlock_uSec)
+			worstBlock_uSec = lastBlock_uSec;
+		if (load > worstBlockLoad)
+			worstBlockLoad = load;
+		blockCount++;
+	}
+
+	double worstBlock_uSec = 0.0;	///< slowest block seen since reset
+	double worstBlockLoad = 0.0;	///< highest time/budget ratio seen since reset
+	double lastBlock_uSec = 0.0;	///< time of the most recent block
+	uint64_t blockCount = 0;		///< blocks measured since reset
+
+private:
+	std::chrono::steady_clock::time_point blockStart;
+};
+
+/**
+\struct EchoplexOscillatorBankParameters
+\brief
+Custom parameter structure for the EchoplexOscillatorBank object; same controls as the
+EchoplexDelayModulatorParameters it replaces.
+*/
+struct EchoplexOscillatorBankParameters
+{
+	EchoplexOscillatorBankParameters() {}
+
+	double delayTime = 90.0;			///< centre delay time (mSec)
+	double lfo1Frequency_Hz = 2.5;		///< wow
+	double lfo1Amplitude = 0.0;			///< mSec per unit of depth
+	double lfo2Frequency_Hz = 5.0;		///< wow
+	double lfo2Amplitude = 0.0;			///< mSec per unit of depth
+	double lfo3Frequency_Hz = 26.0;		///< flutter
+	double lfo3Amplitude = 0.0;			///< mSec per unit of depth
+	double lfoDepth_Pct = 50.0;			///< scales all three LFOs
+	double noiseFilterFc_Hz = 50.0;		///< low-pass cutoff for the scrape-flutter noise
+	double noiseFilterAmplitude = 1.0;	///< mSec of filtered noise
+};
+
+/**
+\class EchoplexOscillatorBank
+\brief
+Renders the tape delay-time modulation (three wow/flutter LFOs plus low-passed noise) a block at a time.
+
+- the three LFOs are recursive quadrature oscillators (a rotating sin/cos pair) held in the lanes of one
+  SSE register, so one multiply/add sequence advances all of them; there is no sin( ) call per sample
+  and the cost is the same whether one or three LFOs are in use
+- the rotation is renormalised once per block to stop amplitude drift
+- the noise is generated and filtered at 1/kNoiseDecimation of the sample rate and linearly interpolated
+  back up; its bandwidth (noisefc <= 100Hz) is far below the decimated Nyquist frequency
+
+Output: delay_mSec = delayTime + (lfoDepth_Pct/100) * sum(lfoN_Amplitude * sin(lfoN)) + noiseFilterAmplitude * noise
+*/
+class EchoplexOscillatorBank
+{
+public:
+	EchoplexOscillatorBank() {}		/* C-TOR */
+	~EchoplexOscillatorBank() {}	/* D-TOR */
+
+	static const uint32_t kNoiseDecimation = 16;
+
+	/** reset phases and filter state; call on sample rate change */
+	bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+
+		for (int i = 0; i < 4; i++)
+		{
+			sinState[i] = 0.0f;
+			cosState[i] = 1.0f;
+		}
+		noiseCounter = 0;
+		noiseLast = 0.0;
+		noiseNext = 0.0;
+		noiseFilterState = 0.0;
+		noiseSeed = 22222;
+
+		cookParameters();
+		return true;
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	EchoplexOscillatorBankParameters getParameters() { return parameters; }
+
+	/** set parameters: oscillator increments and filter coefficient are recalculated only on change */
+	void setParameters(const EchoplexOscillatorBankParameters& params)
+	{
+		bool recook = params.lfo1Frequency_Hz != parameters.lfo1Frequency_Hz ||
+					  params.lfo2Frequency_Hz != parameters.lfo2Frequency_Hz ||
+					  params.lfo3Frequency_Hz != parameters.lfo3Frequency_Hz ||
+					  params.noiseFilterFc_Hz != parameters.noiseFilterFc_Hz;
+
+		parameters = params;
+
+		double depth = parameters.lfoDepth_Pct / 100.0;
+		amplitude[0] = (float)(depth * parameters.lfo1Amplitude);
+		amplitude[1] = (float)(depth * parameters.lfo2Amplitude);
+		amplitude[2] = (float)(depth * parameters.lfo3Amplitude);
+		amplitude[3] = 0.0f;
+
+		if (recook)
+			cookParameters();
+	}
+
+	/** render numFrames of delay time (mSec) into delay_mSec */
+	void renderBlock(float* delay_mSec, uint32_t numFrames)
+	{
+		float centre = (float)parameters.delayTime;
+		float noiseGain = (float)parameters.noiseFilterAmplitude;
+
+#if ECHOPLEX_SSE
+		__m128 s = _mm_loadu_ps(sinState);
+		__m128 c = _mm_loadu_ps(cosState);
+		__m128 si = _mm_loadu_ps(sinIncrement);
+		__m128 ci = _mm_loadu_ps(cosIncrement);
+		__m128 amp = _mm_loadu_ps(amplitude);
+#endif
+
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+#if ECHOPLEX_SSE
+			__m128 sNext = _mm_add_ps(_mm_mul_ps(s, ci), _mm_mul_ps(c, si));
+			c = _mm_sub_ps(_mm_mul_ps(c, ci), _mm_mul_ps(s, si));
+			s = sNext;
+
+			// --- horizontal sum of amp * sin
+			__m128 sum = _mm_mul_ps(s, amp);
+			sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+			sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+			float lfoSum = _mm_cvtss_f32(sum);
+#else
+			float lfoSum = 0.0f;
+			for (int n = 0; n < 3; n++)
+			{
+				float sNext = sinState[n] * cosIncrement[n] + cosState[n] * sinIncrement[n];
+				cosState[n] = cosState[n] * cosIncrement[n] - sinState[n] * sinIncrement[n];
+				sinState[n] = sNext;
+				lfoSum += amplitude[n] * sNext;
+			}
+#endif
+			delay_mSec[i] = centre + lfoSum + noiseGain * renderNoise();
+			if (delay_mSec[i] < 0.0f)
+				delay_mSec[i] = 0.0f;
+		}
+
+#if ECHOPLEX_SSE
+		// --- pull each sin/cos pair back onto the unit circle: g = 1.5 - 0.5*(s^2 + c^2)
+		__m128 mag = _mm_add_ps(_mm_mul_ps(s, s), _mm_mul_ps(c, c));
+		__m128 g = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_set1_ps(0.5f), mag));
+		_mm_storeu_ps(sinState, _mm_mul_ps(s, g));
+		_mm_storeu_ps(cosState, _mm_mul_ps(c, g));
+#else
+		for (int n = 0; n < 3; n++)
+		{
+			float g = 1.5f - 0.5f * (sinState[n] * sinState[n] + cosState[n] * cosState[n]);
+			sinState[n] *= g;
+			cosState[n] *= g;
+		}
+#endif
+	}
+
+protected:
+	EchoplexOscillatorBankParameters parameters;
+	double sampleRate = 44100.0;
+
+	// --- lane 3 is unused padding; its increment is the identity rotation and its amplitude is 0
+	alignas(16) float sinState[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	alignas(16) float cosState[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	alignas(16) float sinIncrement[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	alignas(16) float cosIncrement[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	alignas(16) float amplitude[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	// --- decimated noise
+	uint32_t noiseCounter = 0;
+	double noiseLast = 0.0;
+	double noiseNext = 0.0;
+	double noiseFilterState = 0.0;
+	double noiseFilterCoeff = 0.0;
+	uint32_t noiseSeed = 22222;
+
+	/** control-rate coefficient calculation; the only place trig/exp functions are called */
+	void cookParameters()
+	{
+		const double freq[3] = { parameters.lfo1Frequency_Hz, parameters.lfo2Frequency_Hz, parameters.lfo3Frequency_Hz };
+		for (int n = 0; n < 3; n++)
+		{
+			double w = 2.0 * 3.14159265358979323846 * freq[n] / sampleRate;
+			sinIncrement[n] = (float)sin(w);
+			cosIncrement[n] = (float)cos(w);
+		}
+
+		double fc = parameters.noiseFilterFc_Hz > 0.0 ? parameters.noiseFilterFc_Hz : 0.0;
+		noiseFilterCoeff = exp(-2.0 * 3.14159265358979323846 * fc * kNoiseDecimation / sampleRate);
+	}
+
+	/** one-pole low-passed white noise, updated every kNoiseDecimation samples and interpolated in between */
+	float renderNoise()
+	{
+		if (noiseCounter == 0)
+		{
+			// --- xorshift32 white noise in [-1, +1]
+			noiseSeed ^= noiseSeed << 13;
+			noiseSeed ^= noiseSeed >> 17;
+			noiseSeed ^= noiseSeed << 5;
+			double white = (double)noiseSeed / 2147483648.0 - 1.0;
+
+			noiseLast = noiseNext;
+			noiseFilterState = (1.0 - noiseFilterCoeff) * white + noiseFilterCoeff * noiseFilterState;
+			noiseNext = noiseFilterState;
+		}
+
+		double frac = (double)noiseCounter / kNoiseDecimation;
+		if (++noiseCounter >= kNoiseDecimation)
+			noiseCounter = 0;
+
+		return (float)(noiseLast + frac * (noiseNext - noiseLast));
+	}
+};
+
+/**
+\struct VarispeedTapeLoopParameters
+\brief
+Custom parameter structure for the VarispeedTapeLoop object.
+*/
+struct VarispeedTapeLoopParameters
+{
+	VarispeedTapeLoopParameters() {}
+
+	double tapeSpeed = 1.0;			///< motor speed, kMinSpeed to kMaxSpeed
+	double headGap_mSec = 90.0;		///< record-to-playback head spacing, expressed as the delay at 1x speed
+	double feedback_Pct = 0.0;		///< playback head fed back to the record head
+	double recordLevel_dB = 0.0;	///< gain into the record head
+	double headBleed_Pct = 0.0;		///< amount of head bleed and inter-track crosstalk
+};
+
+/**
+\class VarispeedTapeLoop
+\brief
+Two-track tape loop whose record and playback heads move through the tape at the motor speed, like
+changing the motor speed on a real machine: the delay is headGap/speed and speed changes bend the pitch
+of everything already on the tape.
+
+Operation:
+- record head: for every input sample the record position advances by speed tape samples; each tape
+  sample crossed is resampled from the input history with a kTaps-tap windowed-sinc polyphase filter,
+  so the write is band-limited (cutoff min(1, speed) of the input Nyquist frequency)
+- playback head: the same polyphase filter reads the tape at the fractional playback position, with a
+  cutoff of min(1, 1/speed) of the tape Nyquist frequency
+- the filter phases are designed in createTapeBuffers( ) for kNumCutoffs quarter-octave cutoffs between
+  1.0 and 0.25; speed and cutoff are picked once per block and the speed is ramped across the block
+- nothing is allocated or designed in processAudioBlock( ); restart( ) rewinds the heads from the audio
+  thread without clearing the tape; whatever the record head has not written over yet stays muted
+- head bleed: two taps at fixed tape offsets either side of the playback head, plus crosstalk from the
+  other track's playback head, are read in the same pass and summed; one shared one-pole low-pass per
+  track (the bleed is mostly long wavelengths) runs over the mix, which is added to the playback output.
+  That is 2 linear-interpolated reads, 3 MACs and one filter update per track and sample. The bleed is
+  output-only: the feedback path records the clean playback head, so bleed never raises the loop gain.
+
+Cost per sample and track is kTaps*2 MACs for the playback head plus speed*kTaps*2 MACs for the record
+head, so 4x speed costs about 2x the 1x case and 0.25x about half.
+*/
+class VarispeedTapeLoop
+{
+public:
+	VarispeedTapeLoop() {}		/* C-TOR */
+	~VarispeedTapeLoop() {}		/* D-TOR */
+
+	static const uint32_t kTaps = 16;
+	static const uint32_t kPhases = 64;
+	static const uint32_t kNumCutoffs = 9;
+	static constexpr double kMinSpeed = 0.25;
+	static constexpr double kMaxSpeed = 4.0;
+
+	// --- head bleed model: tap offsets are tape distances expressed in mSec at 1x
+	static constexpr double kBleedAhead_mSec = 8.0;
+	static constexpr double kBleedBehind_mSec = 15.0;
+	static constexpr double kBleedFilterFc_Hz = 1200.0;
+	static constexpr float kBleedAheadGain = 0.12f;
+	static constexpr float kBleedBehindGain = 0.08f;
+	static constexpr float kCrosstalkGain = 0.05f;
+
+	/** clear the tape and heads; allocates on a rate change and clears the whole tape, so not real-time safe */
+	bool reset(double _sampleRate)
+	{
+		if (sampleRate != _sampleRate || tapeL.empty())
+			createTapeBuffers(_sampleRate, maxHeadGap_mSec);
+
+		std::fill(tapeL.begin(), tapeL.end(), 0.0f);
+		std::fill(tapeR.begin(), tapeR.end(), 0.0f);
+		restart();
+
+		// --- a blank tape plays silence anyway, so every head may read it straight away
+		recorded = tapeLength;
+		return true;
+	}
+
+	/** real-time safe: heads, record history and filters back to the start, the tape itself untouched.
+		Until the record head has covered a read position again, that head or bleed tap stays silent, so
+		audio left on the tape before the restart is never played */
+	void restart()
+	{
+		std::fill(historyL, historyL + 2 * kTaps, 0.0f);
+		std::fill(historyR, historyR + 2 * kTaps, 0.0f);
+		historyIndex = 0;
+		writePosition = 0.0;
+		recorded = 0.0;
+		currentSpeed = clampSpeed(parameters.tapeSpeed);
+		currentGap = headGapSamples(parameters.headGap_mSec);
+		feedbackL = 0.0f;
+		feedbackR = 0.0f;
+		bleedStateL = 0.0f;
+		bleedStateR = 0.0f;
+	}
+
+	/** allocate the tape for the longest head gap at the slowest speed and design the filter phases */
+	void createTapeBuffers(double _sampleRate, double _maxHeadGap_mSec)
+	{
+		sampleRate = _sampleRate;
+		maxHeadGap_mSec = _maxHeadGap_mSec;
+
+		bleedAhead = kBleedAhead_mSec * sampleRate / 1000.0;
+		bleedBehind = kBleedBehind_mSec * sampleRate / 1000.0;
+		bleedCoeff = (float)(1.0 - exp(-2.0 * 3.14159265358979323846 * kBleedFilterFc_Hz / sampleRate));
+
+		// --- head gap in tape samples does not depend on speed; the trailing bleed tap reads bleedBehind
+		//     further back, plus padding for the filter windows
+		uint32_t minLength = (uint32_t)(maxHeadGap_mSec * sampleRate / 1000.0 + bleedBehind) + 4 * kTaps + 8;
+		tapeLength = 1;
+		while (tapeLength < minLength)
+			tapeLength <<= 1;
+		tapeMask = tapeLength - 1;
+
+		// --- kTaps guard samples mirror the start of the tape so filter windows never wrap
+		tapeL.assign(tapeLength + kTaps, 0.0f);
+		tapeR.assign(tapeLength + kTaps, 0.0f);
+
+		designFilterPhases();
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	VarispeedTapeLoopParameters getParameters() { return parameters; }
+
+	/** set parameters: note use of custom structure for passing param data */
+	void setParameters(const VarispeedTapeLoopParameters& params)
+	{
+		parameters = params;
+		feedback = (float)(parameters.feedback_Pct / 100.0);
+		recordGain = (float)pow(10.0, parameters.recordLevel_dB / 20.0);
+		bleedAmount = (float)(parameters.headBleed_Pct / 100.0);
+	}
+
+	/** process a block of both tracks; speedMod (optional) multiplies the motor speed per sample (wow/flutter) */
+	void processAudioBlock(const float* inputL, const float* inputR, float* outputL, float* outputR,
+						   const float* speedMod, uint32_t numFrames)
+	{
+		// --- ramp the motor speed across the block; the filter cutoffs are chosen for the fastest/slowest point
+		double targetSpeed = clampSpeed(parameters.tapeSpeed);
+		double speedInc = (targetSpeed - currentSpeed) / numFrames;
+		double blockMin = fmin(currentSpeed, targetSpeed);
+		double blockMax = fmax(currentSpeed, targetSpeed);
+		if (speedMod)
+		{
+			float modMin = speedMod[0];
+			float modMax = speedMod[0];
+			for (uint32_t i = 1; i < numFrames; i++)
+			{
+				modMin = fminf(modMin, speedMod[i]);
+				modMax = fmaxf(modMax, speedMod[i]);
+			}
+			blockMin *= modMin;
+			blockMax *= modMax;
+		}
+		const float* recordPhases = phaseTable(fmin(1.0, blockMin));
+		const float* playPhases = phaseTable(fmin(1.0, 1.0 / blockMax));
+
+		// --- glide the playback head to a new gap over ~50mSec instead of jumping
+		double targetGap = headGapSamples(parameters.headGap_mSec);
+		double gapCoeff = exp(-1.0 / (0.05 * sampleRate));
+
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			currentSpeed += speedInc;
+			double speed = speedMod ? clampSpeed(currentSpeed * speedMod[i]) : currentSpeed;
+			currentGap = targetGap + gapCoeff * (currentGap - targetGap);
+
+			// --- playback head
+			double readPosition = writePosition - currentGap;
+			if (readPosition < 0.0)
+				readPosition += tapeLength;
+			double readFloor = floor(readPosition);
+			uint32_t readStart = ((uint32_t)readFloor - (kTaps / 2 - 1)) & tapeMask;
+			double readFrac = readPosition - readFloor;
+
+			float yL = 0.0f;
+			float yR = 0.0f;
+			if (isRecorded(currentGap))
+			{
+				yL = interpolate(&tapeL[readStart], playPhases, readFrac);
+				yR = interpolate(&tapeR[readStart], playPhases, readFrac);
+			}
+
+			// --- head bleed and crosstalk, filtered once per track
+			double aheadPosition = readPosition + bleedAhead;
+			double behindPosition = readPosition - bleedBehind;
+			aheadPosition = aheadPosition >= tapeLength ? aheadPosition - tapeLength : aheadPosition;
+			behindPosition = behindPosition < 0.0 ? behindPosition + tapeLength : behindPosition;
+
+			float aheadGain = isRecorded(currentGap - bleedAhead) ? kBleedAheadGain : 0.0f;
+			float behindGain = isRecorded(currentGap + bleedBehind) ? kBleedBehindGain : 0.0f;
+			float bleedL = aheadGain * readLinear(tapeL, aheadPosition) + behindGain * readLinear(tapeL, behindPosition) + kCrosstalkGain * yR;
+			float bleedR = aheadGain * readLinear(tapeR, aheadPosition) + behindGain * readLinear(tapeR, behindPosition) + kCrosstalkGain * yL;
+			bleedStateL += bleedCoeff * (bleedAmount * bleedL - bleedStateL);
+			bleedStateR += bleedCoeff * (bleedAmount * bleedR - bleedStateR);
+			bleedStateL = fabsf(bleedStateL) < 1.0e-15f ? 0.0f : bleedStateL;
+			bleedStateR = fabsf(bleedStateR) < 1.0e-15f ? 0.0f : bleedStateR;
+
+			// --- only the clean playback head is recorded back; the bleed taps are extra paths around the
+			//     loop and would push its gain above 1 at high feedback. Explicit flush so the feedback
+			//     state never goes subnormal, even without FTZ
+			feedbackL = fabsf(yL) < 1.0e-15f ? 0.0f : yL;
+			feedbackR = fabsf(yR) < 1.0e-15f ? 0.0f : yR;
+
+			// --- record head input: new audio plus feedback
+			historyL[historyIndex] = historyL[historyIndex + kTaps] = recordGain * inputL[i] + feedback * feedbackL;
+			historyR[historyIndex] = historyR[historyIndex + kTaps] = recordGain * inputR[i] + feedback * feedbackR;
+			if (++historyIndex >= kTaps)
+				historyIndex = 0;
+			const float* windowL = historyL + historyIndex;
+			const float* windowR = historyR + historyIndex;
+
+			// --- record head: write every tape sample crossed during this input sample
+			double nextPosition = writePosition + speed;
+			double invSpeed = 1.0 / speed;
+			for (double k = floor(writePosition) + 1.0; k <= nextPosition; k += 1.0)
+			{
+				double frac = (k - writePosition) * invSpeed;
+				uint32_t index = (uint32_t)k & tapeMask;
+				tapeL[index] = interpolate(windowL, recordPhases, frac);
+				tapeR[index] = interpolate(windowR, recordPhases, frac);
+				if (index < kTaps)
+				{
+					tapeL[index + tapeLength] = tapeL[index];
+					tapeR[index + tapeLength] = tapeR[index];
+				}
+			}
+			writePosition = nextPosition >= tapeLength ? nextPosition - tapeLength : nextPosition;
+			if (recorded < tapeLength)
+				recorded += speed;
+
+			outputL[i] = yL + bleedStateL;
+			outputR[i] = yR + bleedStateR;
+		}
+		currentSpeed = targetSpeed;
+	}
+
+protected:
+	VarispeedTapeLoopParameters parameters;
+	double sampleRate = 0.0;
+	double maxHeadGap_mSec = 700.0;
+
+	// --- tape
+	std::vector<float> tapeL;
+	std::vector<float> tapeR;
+	uint32_t tapeLength = 0;
+	uint32_t tapeMask = 0;
+	double writePosition = 0.0;
+	double recorded = 0.0;			///< tape written since restart( ), saturating at tapeLength
+	double currentSpeed = 1.0;
+	double currentGap = 0.0;
+
+	// --- record head input history, stored twice so the filter window is always contiguous
+	float historyL[2 * kTaps] = { 0.0f };
+	float historyR[2 * kTaps] = { 0.0f };
+	uint32_t historyIndex = 0;
+
+	float feedback = 0.0f;
+	float recordGain = 1.0f;
+	float feedbackL = 0.0f;
+	float feedbackR = 0.0f;
+
+	// --- head bleed
+	double bleedAhead = 0.0;
+	double bleedBehind = 0.0;
+	float bleedAmount = 0.0f;
+	float bleedCoeff = 0.0f;
+	float bleedStateL = 0.0f;
+	float bleedStateR = 0.0f;
+
+	// --- [cutoff][phase 0..kPhases][tap]
+	std::vector<float> phases;
+
+	double clampSpeed(double speed) { return fmin(kMaxSpeed, fmax(kMinSpeed, speed)); }
+
+	double headGapSamples(double gap_mSec)
+	{
+		double gap = fmin(gap_mSec, maxHeadGap_mSec) * sampleRate / 1000.0;
+		return fmax(gap, bleedAhead + 2.0 * kTaps);
+	}
+
+	/** true once the tape this far behind the record head, filter window included, was written after restart( ) */
+	bool isRecorded(double distance) { return recorded >= distance + kTaps / 2 + 1; }
+
+	/** cheap read for the bleed taps; position must be in [0, tapeLength) */
+	float readLinear(const std::vector<float>& tape, double position)
+	{
+		uint32_t index = (uint32_t)position;
+		float frac = (float)(position - index);
+		return tape[index] + frac * (tape[index + 1] - tape[index]);
+	}
+
+	/** highest designed cutoff that is <= the requested one: cutoff[n] = 2^(-n/4) */
+	const float* phaseTable(double cutoff)
+	{
+		int n = (int)ceil(-4.0 * log2(fmax(cutoff, 0.25)) - 1.0e-9);
+		n = n < 0 ? 0 : (n >= (int)kNumCutoffs ? kNumCutoffs - 1 : n);
+		return &phases[n * (kPhases + 1) * kTaps];
+	}
+
+	/** Blackman-windowed sinc, one set of kTaps coefficients per phase, each normalised to unity DC gain */
+	void designFilterPhases()
+	{
+		const double pi = 3.14159265358979323846;
+		const double halfLength = kTaps / 2.0;
+		phases.assign(kNumCutoffs * (kPhases + 1) * kTaps, 0.0f);
+
+		for (uint32_t n = 0; n < kNumCutoffs; n++)
+		{
+			double cutoff = pow(2.0, -(double)n / 4.0);
+			for (uint32_t p = 0; p <= kPhases; p++)
+			{
+				double frac = (double)p / kPhases;
+				float* h = &phases[(n * (kPhases + 1) + p) * kTaps];
+				double sum = 0.0;
+				for (uint32_t i = 0; i < kTaps; i++)
+				{
+					double t = (double)i - (halfLength - 1.0) - frac;
+					double sinc = t == 0.0 ? 1.0 : sin(pi * cutoff * t) / (pi * cutoff * t);
+					double w = (t + halfLength) / (2.0 * halfLength);
+					double window = w <= 0.0 || w >= 1.0 ? 0.0 : 0.42 - 0.5 * cos(2.0 * pi * w) + 0.08 * cos(4.0 * pi * w);
+					h[i] = (float)(sinc * window);
+					sum += h[i];
+				}
+				for (uint32_t i = 0; i < kTaps; i++)
+					h[i] = (float)(h[i] / sum);
+			}
+		}
+	}
+
+	/** value at position (kTaps/2 - 1 + frac) of window x, interpolating linearly between adjacent phases */
+	static float interpolate(const float* x, const float* table, double frac)
+	{
+		double position = frac * kPhases;
+		uint32_t p = (uint32_t)position;
+		if (p >= kPhases)
+			p = kPhases - 1;
+		float blend = (float)(position - p);
+
+		const float* h0 = table + p * kTaps;
+		const float* h1 = h0 + kTaps;
+		float y0 = 0.0f;
+		float y1 = 0.0f;
+		for (uint32_t i = 0; i < kTaps; i++)
+		{
+			y0 += x[i] * h0[i];
+			y1 += x[i] * h1[i];
+		}
+		return y0 + blend * (y1 - y0);
+	}
+};
+
+#endif /* defined(__echoplexDSP_h__) */
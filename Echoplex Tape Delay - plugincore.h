@@ -1,238 +1,275 @@
-// -----------------------------------------------------------------------------
-//    ASPiK Plugin Kernel File:  plugincore.h
-//
-/**
-    \file   plugincore.h
-    \author Will Pirkle
-    \date   17-September-2018
-    \brief  base class interface file for ASPiK plugincore object
-    		- http://www.aspikplugins.com
-    		- http://www.willpirkle.com
-*/
-// -----------------------------------------------------------------------------
-#ifndef __pluginCore_h__
-#define __pluginCore_h__
-
-#include "pluginbase.h"
-#include "tapedelay.h"
-#include "delaymod.h"
-
-// **--0x7F1F--**
-
-// --- Plugin Variables controlID Enumeration 
-
-enum controlID {
-	bandLimitHPFFc_Hz = 0,
-	bandLimitLPFFc_Hz = 1,
-	limiterThreshold_dB = 2,
-	limiterMakeUpGain_dB = 3,
-	recordLevel_dB = 4,
-	playbackLevel_dB = 5,
-	drygain = 14,
-	feebackpercent = 15,
-	lfo1freq = 20,
-	lfo2freq = 21,
-	lfo3freq = 22,
-	lfo1gain = 30,
-	lfo2gain = 31,
-	lfo3gain = 32,
-	lfodepth = 23,
-	noisefc = 25,
-	noisegain = 35,
-	delaytime = 27,
-	waveshaperSaturation = 50,
-	sixtyHzNoiseAmplitude = 51,
-	tapeNoiseFc_Hz = 52,
-	tapeNoiseAmplitude = 53,
-	outputAmplitude_dB = 54
-};
-
-	// **--0x0F1F--**
-
-/**
-\class PluginCore
-\ingroup ASPiK-Core
-\brief
-The PluginCore object is the default PluginBase derived object for ASPiK projects.
-Note that you are fre to change the name of this object (as long as you change it in the compiler settings, etc...)
-
-
-PluginCore Operations:
-- overrides the main processing functions from the base class
-- performs reset operation on sub-modules
-- processes audio
-- processes messages for custom views
-- performs pre and post processing functions on parameters and audio (if needed)
-
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
-*/
-class PluginCore : public PluginBase
-{
-public:
-    PluginCore();
-
-	/** Destructor: empty in default version */
-    virtual ~PluginCore(){}
-
-	// --- PluginBase Overrides ---
-	//
-	/** this is the creation function for all plugin parameters */
-	bool initPluginParameters();
-
-	/** called when plugin is loaded, a new audio file is playing or sample rate changes */
-	virtual bool reset(ResetInfo& resetInfo);
-
-	/** one-time post creation init function; pluginInfo contains path to this plugin */
-	virtual bool initialize(PluginInfo& _pluginInfo);
-
-	// --- preProcess: sync GUI parameters here; override if you don't want to use automatic variable-binding
-	virtual bool preProcessAudioBuffers(ProcessBufferInfo& processInfo);
-
-	/** process frames of data */
-	virtual bool processAudioFrame(ProcessFrameInfo& processFrameInfo);
-
-	// --- uncomment and override this for buffer processing; see base class implementation for
-	//     help on breaking up buffers and getting info from processBufferInfo
-	//virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
-
-	/** preProcess: do any post-buffer processing required; default operation is to send metering data to GUI  */
-	virtual bool postProcessAudioBuffers(ProcessBufferInfo& processInfo);
-
-	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
-	virtual bool updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
-
-	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
-	virtual bool updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo);
-
-	/** this can be called: 1) after bound variable has been updated or 2) after smoothing occurs  */
-	virtual bool postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
-
-	/** this is ony called when the user makes a GUI control change */
-	virtual bool guiParameterChanged(int32_t controlID, double actualValue);
-
-	/** processMessage: messaging system; currently used for custom/special GUI operations */
-	virtual bool processMessage(MessageInfo& messageInfo);
-
-	/** processMIDIEvent: MIDI event processing */
-	virtual bool processMIDIEvent(midiEvent& event);
-
-	/** specialized joystick servicing (currently not used) */
-	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData);
-
-	/** create the presets */
-	bool initPluginPresets();
-
-	// --- BEGIN USER VARIABLES AND FUNCTIONS -------------------------------------- //
-	//	   Add your variables and methods here
-
-	EchoPlexTapeDelay tapedelay;
-	EchoplexDelayModulator delaymod;
-	void UpdateParameters();
-
-	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
-
-private:
-	//  **--0x07FD--**
-
-	// --- Continuous Plugin Variables 
-	double bandLimitHPFFc_Hz = 0.0;
-	double bandLimitLPFFc_Hz = 0.0;
-	double limiterThreshold_dB = 0.0;
-	double limiterMakeUpGain_dB = 0.0;
-	double recordLevel_dB = 0.0;
-	double playbackLevel_dB = 0.0;
-	double drygain = 0.0;
-	double feebackpercent = 0.0;
-	double lfo1freq = 0.0;
-	double lfo2freq = 0.0;
-	double lfo3freq = 0.0;
-	double lfo1gain = 0.0;
-	double lfo2gain = 0.0;
-	double lfo3gain = 0.0;
-	double lfodepth = 0.0;
-	double noisefc = 0.0;
-	double noisegain = 0.0;
-	double delaytime = 0.0;
-	double waveshaperSaturation = 0.0;
-	double sixtyHzNoiseAmplitude = 0.0;
-	double tapeNoiseFc_Hz = 0.0;
-	double tapeNoiseAmplitude = 0.0;
-	double outputAmplitude_dB = 0.0;
-
-
-	// **--0x1A7F--**
-    // --- end member variables
-
-public:
-    /** static description: bundle folder name
-
-	\return bundle folder name as a const char*
-	*/
-    static const char* getPluginBundleName();
-
-    /** static description: name
-
-	\return name as a const char*
-	*/
-    static const char* getPluginName();
-
-	/** static description: short name
-
-	\return short name as a const char*
-	*/
-	static const char* getShortPluginName();
-
-	/** static description: vendor name
-
-	\return vendor name as a const char*
-	*/
-	static const char* getVendorName();
-
-	/** static description: URL
-
-	\return URL as a const char*
-	*/
-	static const char* getVendorURL();
-
-	/** static description: email
-
-	\return email address as a const char*
-	*/
-	static const char* getVendorEmail();
-
-	/** static description: Cocoa View Factory Name
-
-	\return Cocoa View Factory Name as a const char*
-	*/
-	static const char* getAUCocoaViewFactoryName();
-
-	/** static description: plugin type
-
-	\return type (FX or Synth)
-	*/
-	static pluginType getPluginType();
-
-	/** static description: VST3 GUID
-
-	\return VST3 GUID as a const char*
-	*/
-	static const char* getVSTFUID();
-
-	/** static description: 4-char code
-
-	\return 4-char code as int
-	*/
-	static int32_t getFourCharCode();
-
-	/** initalizer */
-	bool initPluginDescriptors();
-
-};
-
-
-
-
-#endif /* defined(__pluginCore_h__) */
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  plugincore.h
+//
+/**
+    \file   plugincore.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  base class interface file for ASPiK plugincore object
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef __pluginCore_h__
+#define __pluginCore_h__
+
+#include "pluginbase.h"
+#include "tapedelay.h"
+#include "echoplexdsp.h"
+
+// --- set to 1 to measure per-block CPU time and build the denormal stress test
+#define ECHOPLEX_BLOCK_PROFILING 0
+
+// **--0x7F1F--**
+
+// --- Plugin Variables controlID Enumeration 
+
+enum controlID {
+	bandLimitHPFFc_Hz = 0,
+	bandLimitLPFFc_Hz = 1,
+	limiterThreshold_dB = 2,
+	limiterMakeUpGain_dB = 3,
+	recordLevel_dB = 4,
+	playbackLevel_dB = 5,
+	drygain = 14,
+	feebackpercent = 15,
+	lfo1freq = 20,
+	lfo2freq = 21,
+	lfo3freq = 22,
+	lfo1gain = 30,
+	lfo2gain = 31,
+	lfo3gain = 32,
+	lfodepth = 23,
+	noisefc = 25,
+	noisegain = 35,
+	delaytime = 27,
+	waveshaperSaturation = 50,
+	sixtyHzNoiseAmplitude = 51,
+	tapeNoiseFc_Hz = 52,
+	tapeNoiseAmplitude = 53,
+	outputAmplitude_dB = 54,
+	tapeMode = 60,
+	tapeSpeed = 61,
+	headBleed = 62
+};
+
+	// **--0x0F1F--**
+
+/**
+\class PluginCore
+\ingroup ASPiK-Core
+\brief
+The PluginCore object is the default PluginBase derived object for ASPiK projects.
+Note that you are fre to change the name of this object (as long as you change it in the compiler settings, etc...)
+
+
+PluginCore Operations:
+- overrides the main processing functions from the base class
+- performs reset operation on sub-modules
+- processes audio
+- processes messages for custom views
+- performs pre and post processing functions on parameters and audio (if needed)
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PluginCore : public PluginBase
+{
+public:
+    PluginCore();
+
+	/** Destructor: empty in default version */
+    virtual ~PluginCore(){}
+
+	// --- PluginBase Overrides ---
+	//
+	/** this is the creation function for all plugin parameters */
+	bool initPluginParameters();
+
+	/** called when plugin is loaded, a new audio file is playing or sample rate changes */
+	virtual bool reset(ResetInfo& resetInfo);
+
+	/** one-time post creation init function; pluginInfo contains path to this plugin */
+	virtual bool initialize(PluginInfo& _pluginInfo);
+
+	// --- preProcess: sync GUI parameters here; override if you don't want to use automatic variable-binding
+	virtual bool preProcessAudioBuffers(ProcessBufferInfo& processInfo);
+
+	/** process frames of data */
+	virtual bool processAudioFrame(ProcessFrameInfo& processFrameInfo);
+
+	/** process buffers of data; FTZ/DAZ, routing decided once per buffer, tape delay run on the host channel pointers */
+	virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
+
+	/** preProcess: do any post-buffer processing required; default operation is to send metering data to GUI  */
+	virtual bool postProcessAudioBuffers(ProcessBufferInfo& processInfo);
+
+	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
+	virtual bool updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
+
+	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
+	virtual bool updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo);
+
+	/** this can be called: 1) after bound variable has been updated or 2) after smoothing occurs  */
+	virtual bool postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
+
+	/** this is ony called when the user makes a GUI control change */
+	virtual bool guiParameterChanged(int32_t controlID, double actualValue);
+
+	/** processMessage: messaging system; currently used for custom/special GUI operations */
+	virtual bool processMessage(MessageInfo& messageInfo);
+
+	/** processMIDIEvent: MIDI event processing */
+	virtual bool processMIDIEvent(midiEvent& event);
+
+	/** specialized joystick servicing (currently not used) */
+	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData);
+
+	/** create the presets */
+	bool initPluginPresets();
+
+	// --- BEGIN USER VARIABLES AND FUNCTIONS -------------------------------------- //
+	//	   Add your variables and methods here
+
+	EchoPlexTapeDelay tapedelay;
+	EchoplexOscillatorBank delaymod;
+	void UpdateParameters();
+	void UpdateDelayModParameters();
+
+	// --- delay modulation is rendered kDelayModBlockSize samples at a time and consumed per frame
+	static const uint32_t kDelayModBlockSize = 32;
+	float delayModBlock[kDelayModBlockSize] = { 0.0f };
+	uint32_t delayModIndex = kDelayModBlockSize;
+
+	// --- varispeed mode: the tape loop replaces the fixed-head delay; wow/flutter modulate the motor speed
+	VarispeedTapeLoop varispeed;
+	int lastTapeMode = 0;
+	float varispeedMod[kDelayModBlockSize] = { 0.0f };
+	float varispeedOutL[kDelayModBlockSize] = { 0.0f };
+	float varispeedOutR[kDelayModBlockSize] = { 0.0f };
+	// --- fixed-head mode limits and sets the output level inside tapedelay; varispeed mode does both here
+	DynamicsProcessor varispeedLimiterL;
+	DynamicsProcessor varispeedLimiterR;
+	void processVarispeedBlock(const float* inputL, const float* inputR, float* outputL, float* outputR,
+							   uint32_t numFrames, IMidiEventQueue* midiEventQueue);
+	bool updateTapeMode();
+
+#if ECHOPLEX_BLOCK_PROFILING
+	BlockProfiler blockProfiler;
+
+	/** impulse followed by silence through the whole plugin; returns the worst-case block time in uSec */
+	double runDenormalStressTest(double sampleRate, uint32_t blockSize, double silence_Sec = 60.0);
+#endif
+
+	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
+
+private:
+	//  **--0x07FD--**
+
+	// --- Continuous Plugin Variables 
+	double bandLimitHPFFc_Hz = 0.0;
+	double bandLimitLPFFc_Hz = 0.0;
+	double limiterThreshold_dB = 0.0;
+	double limiterMakeUpGain_dB = 0.0;
+	double recordLevel_dB = 0.0;
+	double playbackLevel_dB = 0.0;
+	double drygain = 0.0;
+	double feebackpercent = 0.0;
+	double lfo1freq = 0.0;
+	double lfo2freq = 0.0;
+	double lfo3freq = 0.0;
+	double lfo1gain = 0.0;
+	double lfo2gain = 0.0;
+	double lfo3gain = 0.0;
+	double lfodepth = 0.0;
+	double noisefc = 0.0;
+	double noisegain = 0.0;
+	double delaytime = 0.0;
+	double waveshaperSaturation = 0.0;
+	double sixtyHzNoiseAmplitude = 0.0;
+	double tapeNoiseFc_Hz = 0.0;
+	double tapeNoiseAmplitude = 0.0;
+	double outputAmplitude_dB = 0.0;
+	double tapeSpeed = 0.0;
+	double headBleed = 0.0;
+
+
+	// --- Discrete Plugin Variables 
+	int tapeMode = 0;
+	enum class tapeModeEnum { Fixed_Heads,Varispeed };	// to compare: if(compareEnumToInt(tapeModeEnum::Fixed_Heads, tapeMode)) etc... 
+
+	// **--0x1A7F--**
+    // --- end member variables
+
+public:
+    /** static description: bundle folder name
+
+	\return bundle folder name as a const char*
+	*/
+    static const char* getPluginBundleName();
+
+    /** static description: name
+
+	\return name as a const char*
+	*/
+    static const char* getPluginName();
+
+	/** static description: short name
+
+	\return short name as a const char*
+	*/
+	static const char* getShortPluginName();
+
+	/** static description: vendor name
+
+	\return vendor name as a const char*
+	*/
+	static const char* getVendorName();
+
+	/** static description: URL
+
+	\return URL as a const char*
+	*/
+	static const char* getVendorURL();
+
+	/** static description: email
+
+	\return email address as a const char*
+	*/
+	static const char* getVendorEmail();
+
+	/** static description: Cocoa View Factory Name
+
+	\return Cocoa View Factory Name as a const char*
+	*/
+	static const char* getAUCocoaViewFactoryName();
+
+	/** static description: plugin type
+
+	\return type (FX or Synth)
+	*/
+	static pluginType getPluginType();
+
+	/** static description: VST3 GUID
+
+	\return VST3 GUID as a const char*
+	*/
+	static const char* getVSTFUID();
+
+	/** static description: 4-char code
+
+	\return 4-char code as int
+	*/
+	static int32_t getFourCharCode();
+
+	/** initalizer */
+	bool initPluginDescriptors();
+
+};
+
+
+
+
+#endif /* defined(__pluginCore_h__) */
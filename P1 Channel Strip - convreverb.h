@@ -0,0 +1,786 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip reverb:  convreverb.h
+//
+/**
+    \file   convreverb.h
+    \brief  partitioned FFT convolution reverb for the P1 Channel Strip
+    		- PartitionedConvolver: one uniformly partitioned overlap-save level
+    		- ConvolutionReverb: zero-latency non-uniform convolution; the long tail runs on a worker thread
+    		- loadWaveFile( ), resampleImpulse( ): IR loading helpers for non-real-time threads
+*/
+// -----------------------------------------------------------------------------
+#ifndef __convReverb_h__
+#define __convReverb_h__
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lockfree.h"
+#include "realfft.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONV_SSE2 1
+#else
+#define CONV_SSE2 0
+#endif
+
+/**
+\struct ConvolutionSegment
+\ingroup P1-Objects
+\brief
+Spectra of one partitioned section of an impulse response, for one PartitionedConvolver level. Each
+partition is stored as [re: stride floats][im: stride floats], already scaled by 1/(N/2) so the
+convolver output needs no normalization.
+*/
+struct ConvolutionSegment
+{
+	ConvolutionSegment() {}
+
+	uint32_t partitions = 0;			///< number of partitions in use
+	uint32_t stride = 0;				///< bins rounded up to a multiple of 4
+	std::vector<float> spectra[2];		///< per output channel
+
+	const float* getPartition(uint32_t channel, uint32_t partition) const { return spectra[channel].data() + 2 * stride * partition; }
+};
+
+/**
+\class PartitionedConvolver
+\ingroup P1-Objects
+\brief
+One level of uniformly partitioned overlap-save convolution (UPOLS) for two channels: block size B,
+FFT size 2B, and a frequency-domain delay line of past input spectra. process( ) takes exactly one
+block of B new input samples and returns B output samples of the input convolved with the segment,
+with no latency beyond the block itself.
+
+- reset( ) allocates for a maximum number of partitions; process( ) never allocates
+- the spectral multiply-accumulate runs 4 bins per SSE instruction
+*/
+class PartitionedConvolver
+{
+public:
+	PartitionedConvolver() {}
+	~PartitionedConvolver() {}
+
+	/** allocate for blockSize (power of two) and up to maxPartitions; clears all state */
+	void reset(uint32_t _blockSize, uint32_t _maxPartitions)
+	{
+		blockSize = _blockSize;
+		maxPartitions = std::max(1u, _maxPartitions);
+		fft.initialize(2 * blockSize);
+		bins = fft.getNumBins();
+		stride = (bins + 3) & ~3u;
+
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			inputSpectra[channel].assign(2 * stride * maxPartitions, 0.0f);
+			previousInput[channel].assign(blockSize, 0.0f);
+		}
+		timeBuffer.assign(2 * blockSize, 0.0f);
+		accumulator.assign(2 * stride, 0.0f);
+		slot = 0;
+	}
+
+	/** zero the input history */
+	void clear()
+	{
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			std::fill(inputSpectra[channel].begin(), inputSpectra[channel].end(), 0.0f);
+			std::fill(previousInput[channel].begin(), previousInput[channel].end(), 0.0f);
+		}
+	}
+
+	uint32_t getBlockSize() const { return blockSize; }
+	uint32_t getStride() const { return stride; }
+	uint32_t getMaxPartitions() const { return maxPartitions; }
+
+	/** one block: input[channel] and output[channel] hold blockSize samples; segment may be null (silence) */
+	void process(const float* const* input, const ConvolutionSegment* segment, float* const* output)
+	{
+		slot = slot + 1 == maxPartitions ? 0 : slot + 1;
+		uint32_t partitions = segment ? std::min(segment->partitions, maxPartitions) : 0;
+
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			// --- overlap-save input: [previous block | this block]
+			std::copy(previousInput[channel].begin(), previousInput[channel].end(), timeBuffer.begin());
+			std::copy(input[channel], input[channel] + blockSize, timeBuffer.begin() + blockSize);
+			std::copy(input[channel], input[channel] + blockSize, previousInput[channel].begin());
+
+			float* spectrum = inputSpectra[channel].data() + 2 * stride * slot;
+			fft.forward(timeBuffer.data(), spectrum, spectrum + stride);
+
+			if (partitions == 0)
+			{
+				std::fill(output[channel], output[channel] + blockSize, 0.0f);
+				continue;
+			}
+
+			// --- sum of (input spectrum k blocks ago) x (partition k)
+			std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+			uint32_t history = slot;
+			for (uint32_t partition = 0; partition < partitions; partition++)
+			{
+				multiplyAccumulate(inputSpectra[channel].data() + 2 * stride * history, segment->getPartition(channel, partition));
+				history = history == 0 ? maxPartitions - 1 : history - 1;
+			}
+
+			// --- the second half of the circular result is the linear convolution
+			fft.inverse(accumulator.data(), accumulator.data() + stride, timeBuffer.data());
+			std::copy(timeBuffer.begin() + blockSize, timeBuffer.end(), output[channel]);
+		}
+	}
+
+protected:
+	RealFFT fft;
+	uint32_t blockSize = 0;
+	uint32_t maxPartitions = 1;
+	uint32_t bins = 0;
+	uint32_t stride = 0;
+	uint32_t slot = 0;
+
+	std::vector<float> inputSpectra[2];		///< maxPartitions slots of [re | im], newest at slot
+	std::vector<float> previousInput[2];
+	std::vector<float> timeBuffer;
+	std::vector<float> accumulator;
+
+	/** accumulator += x * h, complex, split layout */
+	void multiplyAccumulate(const float* x, const float* h)
+	{
+		float* accRe = accumulator.data();
+		float* accIm = accRe + stride;
+		const float* xRe = x;
+		const float* xIm = x + stride;
+		const float* hRe = h;
+		const float* hIm = h + stride;
+
+#if CONV_SSE2
+		for (uint32_t k = 0; k < stride; k += 4)
+		{
+			__m128 xr = _mm_loadu_ps(xRe + k), xi = _mm_loadu_ps(xIm + k);
+			__m128 hr = _mm_loadu_ps(hRe + k), hi = _mm_loadu_ps(hIm + k);
+			_mm_storeu_ps(accRe + k, _mm_add_ps(_mm_loadu_ps(accRe + k), _mm_sub_ps(_mm_mul_ps(xr, hr), _mm_mul_ps(xi, hi))));
+			_mm_storeu_ps(accIm + k, _mm_add_ps(_mm_loadu_ps(accIm + k), _mm_add_ps(_mm_mul_ps(xr, hi), _mm_mul_ps(xi, hr))));
+		}
+#else
+		for (uint32_t k = 0; k < bins; k++)
+		{
+			accRe[k] += xRe[k] * hRe[k] - xIm[k] * hIm[k];
+			accIm[k] += xRe[k] * hIm[k] + xIm[k] * hRe[k];
+		}
+#endif
+	}
+};
+
+/**
+\brief read a PCM (16/24/32 bit) or IEEE float (32/64 bit) WAV file; multichannel files keep their
+first two channels. Allocates and does file I/O; never call from the audio thread.
+
+\param path file to read
+\param left, right receive the samples; right is a copy of left for mono files
+\param channels receives 1 or 2
+\param sampleRate receives the file's sample rate
+
+\return true if the file was read
+*/
+inline bool loadWaveFile(const std::string& path, std::vector<float>& left, std::vector<float>& right, uint32_t& channels, double& sampleRate)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file)
+		return false;
+
+	std::vector<uint8_t> data;
+	uint8_t buffer[4096];
+	size_t count = 0;
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		data.insert(data.end(), buffer, buffer + count);
+	fclose(file);
+
+	auto read16 = [&](size_t at) { return (uint32_t)data[at] | ((uint32_t)data[at + 1] << 8); };
+	auto read32 = [&](size_t at) { return read16(at) | (read16(at + 2) << 16); };
+
+	if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 || memcmp(data.data() + 8, "WAVE", 4) != 0)
+		return false;
+
+	uint32_t format = 0, fileChannels = 0, bits = 0, rate = 0;
+	size_t dataStart = 0, dataSize = 0;
+	for (size_t at = 12; at + 8 <= data.size();)
+	{
+		uint32_t chunkSize = read32(at + 4);
+		size_t body = at + 8;
+		if (memcmp(data.data() + at, "fmt ", 4) == 0 && chunkSize >= 16 && body + 16 <= data.size())
+		{
+			format = read16(body);
+			fileChannels = read16(body + 2);
+			rate = read32(body + 4);
+			bits = read16(body + 14);
+
+			// --- WAVE_FORMAT_EXTENSIBLE: the real format is the first word of the subformat GUID
+			if (format == 0xFFFE && chunkSize >= 26 && body + 26 <= data.size())
+				format = read16(body + 24);
+		}
+		else if (memcmp(data.data() + at, "data", 4) == 0)
+		{
+			dataStart = body;
+			dataSize = std::min((size_t)chunkSize, data.size() - body);
+		}
+		at = body + chunkSize + (chunkSize & 1);
+	}
+
+	bool pcm = format == 1 && (bits == 16 || bits == 24 || bits == 32);
+	bool ieee = format == 3 && (bits == 32 || bits == 64);
+	if (!(pcm || ieee) || fileChannels == 0 || rate == 0 || dataStart == 0)
+		return false;
+
+	uint32_t bytes = bits / 8;
+	size_t frames = dataSize / (bytes * fileChannels);
+	channels = std::min(fileChannels, 2u);
+	sampleRate = rate;
+	left.resize(frames);
+	right.resize(frames);
+
+	for (size_t frame = 0; frame < frames; frame++)
+	{
+		for (uint32_t channel = 0; channel < channels; channel++)
+		{
+			size_t at = dataStart + (frame * fileChannels + channel) * bytes;
+			float value = 0.0f;
+			if (pcm && bits == 16)
+				value = (int16_t)read16(at) / 32768.0f;
+			else if (pcm && bits == 24)
+				value = (int32_t)((read16(at) << 8) | ((uint32_t)data[at + 2] << 24)) / 2147483648.0f;
+			else if (pcm)
+				value = (int32_t)read32(at) / 2147483648.0f;
+			else if (bits == 32)
+			{
+				uint32_t word = read32(at);
+				memcpy(&value, &word, sizeof(value));
+			}
+			else
+			{
+				uint64_t word = read32(at) | ((uint64_t)read32(at + 4) << 32);
+				double wide = 0.0;
+				memcpy(&wide, &word, sizeof(wide));
+				value = (float)wide;
+			}
+			(channel == 0 ? left : right)[frame] = value;
+		}
+	}
+
+	if (channels == 1)
+		right = left;
+	return true;
+}
+
+/**
+\brief band-limited resampling of an impulse response with a Blackman-windowed sinc (32 zero
+crossings each side, cutoff lowered when downsampling). Allocates; never call from the audio thread.
+
+\param input impulse response at inputRate
+\param output receives the response at outputRate, at most maxLength samples
+*/
+inline void resampleImpulse(const std::vector<float>& input, double inputRate, double outputRate, size_t maxLength, std::vector<float>& output)
+{
+	if (inputRate == outputRate)
+	{
+		output.assign(input.begin(), input.begin() + std::min(input.size(), maxLength));
+		return;
+	}
+
+	const double kPi = 3.14159265358979323846;
+	const double kZeroCrossings = 32.0;
+	double ratio = outputRate / inputRate;
+	double cutoff = std::min(1.0, ratio);
+	double halfWidth = kZeroCrossings / cutoff;		// in input samples
+
+	size_t length = std::min((size_t)ceil(input.size() * ratio), maxLength);
+	output.assign(length, 0.0f);
+
+	for (size_t n = 0; n < length; n++)
+	{
+		double center = n / ratio;
+		long first = std::max(0L, (long)ceil(center - halfWidth));
+		long last = std::min((long)input.size() - 1, (long)floor(center + halfWidth));
+
+		double sum = 0.0;
+		for (long i = first; i <= last; i++)
+		{
+			double t = center - i;
+			double x = kPi * cutoff * t;
+			double sinc = fabs(x) < 1.0e-9 ? 1.0 : sin(x) / x;
+			double w = 0.5 + 0.5 * t / halfWidth;		// 0..1 across the window
+			double window = 0.42 - 0.5 * cos(2.0 * kPi * w) + 0.08 * cos(4.0 * kPi * w);
+			sum += input[i] * cutoff * sinc * window;
+		}
+		output[n] = (float)sum;
+	}
+}
+
+/**
+\struct ConvolutionKernel
+\ingroup P1-Objects
+\brief
+A prepared impulse response: direct-form taps for the first block and partition spectra for the three
+convolver levels. Built off the audio thread by ConvolutionReverb's loader and handed over by pointer.
+*/
+struct ConvolutionKernel
+{
+	ConvolutionKernel() {}
+
+	static const uint32_t kDirectLength = 64;
+
+	double sampleRate = 0.0;
+	float direct[2][kDirectLength] = { { 0.0f } };		///< taps 0..63, time-reversed for the dot product
+	ConvolutionSegment head;							///< 64-sample partitions
+	ConvolutionSegment body;							///< 512-sample partitions
+	ConvolutionSegment tail;							///< 2048-sample partitions, worker thread
+};
+
+/**
+\struct ConvolutionReverbParameters
+\ingroup P1-Objects
+\brief
+Custom parameter structure for the ConvolutionReverb object.
+*/
+struct ConvolutionReverbParameters
+{
+	ConvolutionReverbParameters() {}
+
+	double wetLevel_dB = -3.0;		///< output level; the IR is normalized to unit energy when it is loaded
+};
+
+/**
+\class ConvolutionReverb
+\ingroup P1-Objects
+\brief
+Zero-latency stereo convolution reverb with a non-uniform partition:
+
+- taps [0, 64): direct-form FIR, per sample
+- taps [64, 512): 64-sample overlap-save partitions, audio thread
+- taps [512, 4096): 512-sample partitions, audio thread
+- taps [4096, end): 2048-sample partitions on a worker thread
+
+Each level starts at an offset equal to its block size (the tail at twice its block size), so every
+result is ready exactly when it is due and nothing adds latency. The audio thread hands the worker one
+2048-sample input block per period and plays the result of the previous one; the exchange is two
+atomic counters over a 4-slot ring, and the worker sleeps on a WorkerWakeup between blocks. If the
+worker misses its deadline the tail for that block is silent and getTailUnderruns( ) counts it.
+
+The tail worker is started by reset( ) together with the IR loader, so it only exists while an IR is
+loaded; the tail is never convolved on the audio thread. Without an IR there is no tail to exchange.
+
+The IR file is read, resampled to the session rate, normalized and partitioned on a loader thread
+started by reset( ). The finished ConvolutionKernel is published through an atomic pointer; the audio
+thread swaps it in at a tail block boundary while the worker is idle, and the worker deletes the old one.
+
+Audio I/O:
+- processes stereo blocks of any length, wet-only; input and output may not alias
+
+Control I/F:
+- setImpulseFile( ) before reset( ); ConvolutionReverbParameters for the wet level
+*/
+class ConvolutionReverb
+{
+public:
+	static const uint32_t kDirectLength = ConvolutionKernel::kDirectLength;
+	static const uint32_t kHeadBlock = 64;
+	static const uint32_t kBodyBlock = 512;
+	static const uint32_t kTailBlock = 2048;
+	static const uint32_t kBodyStart = kBodyBlock;
+	static const uint32_t kTailStart = 2 * kTailBlock;
+	static const uint32_t kTailSlots = 4;
+
+	static constexpr double kMaxImpulse_Sec = 6.0;
+
+	ConvolutionReverb() {}
+	~ConvolutionReverb() { stopThreads(); releaseKernels(); }
+
+	ConvolutionReverb(const ConvolutionReverb&) = delete;
+	ConvolutionReverb& operator=(const ConvolutionReverb&) = delete;
+
+	/** IR file to load on the next reset( ) */
+	void setImpulseFile(const std::string& path) { impulsePath = path; }
+
+	/** stop the threads, allocate for this sample rate, then start loading the IR and the tail worker
+		that convolves it. Not real-time safe */
+	bool reset(double _sampleRate)
+	{
+		stopThreads();
+		releaseKernels();
+		sampleRate = _sampleRate;
+
+		uint32_t maxLength = (uint32_t)(kMaxImpulse_Sec * sampleRate);
+		head.reset(kHeadBlock, (kBodyStart - kDirectLength) / kHeadBlock);
+		body.reset(kBodyBlock, (kTailStart - kBodyStart) / kBodyBlock);
+		tail.reset(kTailBlock, maxLength > kTailStart ? (maxLength - kTailStart + kTailBlock - 1) / kTailBlock : 1);
+
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			headInput[channel].assign(kHeadBlock, 0.0f);
+			headOutput[channel].assign(kHeadBlock, 0.0f);
+			bodyInput[channel].assign(kBodyBlock, 0.0f);
+			bodyOutput[channel].assign(kBodyBlock, 0.0f);
+			std::fill(directHistory[channel], directHistory[channel] + 2 * kDirectLength, 0.0f);
+			for (uint32_t slot = 0; slot <= kTailSlots; slot++)
+				tailInput[slot][channel].assign(kTailBlock, 0.0f);
+			for (uint32_t slot = 0; slot < kTailSlots; slot++)
+				tailOutput[slot][channel].assign(kTailBlock, 0.0f);
+		}
+		for (uint32_t slot = 0; slot < kTailSlots; slot++)
+			tailKernel[slot] = nullptr;
+
+		position = 0;
+		directIndex = 0;
+		tailFill = 0;
+		tailPlay = -1;
+		tailFillSubmits = false;
+		tailSubmitted.store(0);
+		tailCompleted.store(0);
+		tailUnderruns.store(0);
+
+		if (!impulsePath.empty())
+		{
+			loaderAbort.store(false);
+			loader = std::thread(&ConvolutionReverb::runLoader, this, impulsePath, sampleRate);
+
+			// --- idle until the first block is submitted; it sleeps on tailWakeup, so it costs nothing
+			tailRunning.store(true);
+			tailWorker = std::thread(&ConvolutionReverb::runTail, this);
+		}
+		return true;
+	}
+
+	/** get parameters */
+	ConvolutionReverbParameters getParameters() { return parameters; }
+
+	/** set parameters */
+	void setParameters(const ConvolutionReverbParameters& _parameters)
+	{
+		parameters = _parameters;
+		wetGain = (float)pow(10.0, parameters.wetLevel_dB / 20.0);
+	}
+
+	/** true once an impulse response has been swapped in */
+	bool hasImpulse() const { return current != nullptr; }
+
+	/** tail blocks that were silenced because the worker was late */
+	uint32_t getTailUnderruns() const { return tailUnderruns.load(std::memory_order_relaxed); }
+
+	/** process a block of any length; outputs are the wet signal only */
+	void processAudioBlock(const float* inputL, const float* inputR, float* outputL, float* outputR, uint32_t numFrames)
+	{
+		if (headInput[0].empty())
+			return;
+
+		uint32_t done = 0;
+		while (done < numFrames)
+		{
+			// --- run up to the next 64-sample boundary, where all the block levels line up
+			uint32_t headPosition = position & (kHeadBlock - 1);
+			uint32_t bodyPosition = position & (kBodyBlock - 1);
+			uint32_t count = std::min(numFrames - done, kHeadBlock - headPosition);
+
+			const float* input[2] = { inputL + done, inputR + done };
+			float* output[2] = { outputL + done, outputR + done };
+
+			for (uint32_t channel = 0; channel < 2; channel++)
+			{
+				std::copy(input[channel], input[channel] + count, headInput[channel].data() + headPosition);
+				std::copy(input[channel], input[channel] + count, bodyInput[channel].data() + bodyPosition);
+				std::copy(input[channel], input[channel] + count, tailInput[tailFill][channel].data() + position);
+
+				const float* headOut = headOutput[channel].data() + headPosition;
+				const float* bodyOut = bodyOutput[channel].data() + bodyPosition;
+				const float* tailOut = tailPlay >= 0 ? tailOutput[tailPlay][channel].data() + position : nullptr;
+				float* history = directHistory[channel];
+				const float* taps = current ? current->direct[channel] : nullptr;
+
+				uint32_t index = directIndex;
+				for (uint32_t i = 0; i < count; i++)
+				{
+					// --- direct FIR over a doubled history, so the last 64 inputs are always contiguous
+					history[index] = history[index + kDirectLength] = input[channel][i];
+					index = (index + 1) & (kDirectLength - 1);
+
+					float y = taps ? dot(taps, history + index) : 0.0f;
+					y += headOut[i] + bodyOut[i];
+					if (tailOut)
+						y += tailOut[i];
+					output[channel][i] = wetGain * y;
+				}
+				if (channel == 1)
+					directIndex = index;
+			}
+
+			position += count;
+			done += count;
+
+			const float* const headIn[2] = { headInput[0].data(), headInput[1].data() };
+			float* const headOut[2] = { headOutput[0].data(), headOutput[1].data() };
+			if ((position & (kHeadBlock - 1)) == 0)
+				head.process(headIn, current ? &current->head : nullptr, headOut);
+
+			const float* const bodyIn[2] = { bodyInput[0].data(), bodyInput[1].data() };
+			float* const bodyOut[2] = { bodyOutput[0].data(), bodyOutput[1].data() };
+			if ((position & (kBodyBlock - 1)) == 0)
+				body.process(bodyIn, current ? &current->body : nullptr, bodyOut);
+
+			if (position == kTailBlock)
+			{
+				position = 0;
+				exchangeTailBlock();
+			}
+		}
+	}
+
+protected:
+	ConvolutionReverbParameters parameters;
+	double sampleRate = 44100.0;
+	float wetGain = 0.707946f;
+	std::string impulsePath;
+
+	// --- audio thread levels
+	PartitionedConvolver head;
+	PartitionedConvolver body;
+	std::vector<float> headInput[2];
+	std::vector<float> headOutput[2];
+	std::vector<float> bodyInput[2];
+	std::vector<float> bodyOutput[2];
+	float directHistory[2][2 * kDirectLength] = { { 0.0f } };
+	uint32_t directIndex = 0;
+	uint32_t position = 0;				///< 0..kTailBlock-1; all block boundaries are multiples of it
+
+	// --- tail exchange: slot kTailSlots is a scratch fill target used while the ring is full
+	PartitionedConvolver tail;			///< worker thread only
+	std::vector<float> tailInput[kTailSlots + 1][2];
+	std::vector<float> tailOutput[kTailSlots][2];
+	const ConvolutionKernel* tailKernel[kTailSlots] = { nullptr };
+	uint32_t tailFill = 0;
+	int32_t tailPlay = -1;
+	bool tailFillSubmits = false;		///< a block was handed over at the last boundary
+	std::atomic<uint64_t> tailSubmitted{ 0 };
+	std::atomic<uint64_t> tailCompleted{ 0 };
+	std::atomic<uint32_t> tailUnderruns{ 0 };
+	std::atomic<bool> tailRunning{ false };
+	WorkerWakeup tailWakeup;
+	std::thread tailWorker;
+
+	// --- kernel handoff: loader -> pending -> current (audio thread) -> retired -> deleted by the worker
+	ConvolutionKernel* current = nullptr;
+	std::atomic<ConvolutionKernel*> pending{ nullptr };
+	std::atomic<ConvolutionKernel*> retired{ nullptr };
+	std::atomic<bool> loaderAbort{ false };
+	std::thread loader;
+
+	static inline float dot(const float* a, const float* b)
+	{
+#if CONV_SSE2
+		__m128 sum = _mm_setzero_ps();
+		for (uint32_t k = 0; k < kDirectLength; k += 4)
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k)));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+		return _mm_cvtss_f32(sum);
+#else
+		float sum = 0.0f;
+		for (uint32_t k = 0; k < kDirectLength; k++)
+			sum += a[k] * b[k];
+		return sum;
+#endif
+	}
+
+	/** audio thread, every kTailBlock samples: play the last result, maybe swap kernels, submit this block */
+	void exchangeTailBlock()
+	{
+		// --- no IR, no worker and nothing to play
+		if (!tailRunning.load(std::memory_order_relaxed))
+			return;
+
+		uint64_t submitted = tailSubmitted.load(std::memory_order_relaxed);
+		uint64_t completed = tailCompleted.load(std::memory_order_acquire);
+
+		// --- the block submitted one period ago is due now
+		if (tailFillSubmits && completed >= submitted)
+			tailPlay = (int32_t)((submitted - 1) % kTailSlots);
+		else
+		{
+			if (submitted > 0)
+				tailUnderruns.fetch_add(1, std::memory_order_relaxed);
+			tailPlay = -1;
+		}
+
+		// --- new kernel: only while the worker is idle and the previous one has been collected
+		if (completed == submitted && retired.load(std::memory_order_acquire) == nullptr)
+		{
+			ConvolutionKernel* kernel = pending.exchange(nullptr, std::memory_order_acq_rel);
+			if (kernel)
+			{
+				if (!current)
+				{
+					head.clear();
+					body.clear();
+				}
+				retired.store(current, std::memory_order_release);
+				current = kernel;
+			}
+		}
+
+		// --- hand over the block just filled, unless it went to the scratch slot
+		tailFillSubmits = tailFill < kTailSlots;
+		if (tailFillSubmits)
+		{
+			tailKernel[tailFill] = current;
+			tailSubmitted.store(++submitted, std::memory_order_release);
+			tailWakeup.notify();
+		}
+
+		// --- next fill slot is free once the block that last used it has completed
+		tailFill = submitted - completed < kTailSlots ? (uint32_t)(submitted % kTailSlots) : kTailSlots;
+	}
+
+	/** tail worker: convolve submitted blocks in order, and delete retired kernels. Sleeps on
+		tailWakeup in between; half a tail period bounds a missed wakeup */
+	void runTail()
+	{
+		const ConvolutionKernel* previous = nullptr;
+		std::chrono::microseconds timeout((int64_t)(0.5e6 * kTailBlock / sampleRate));
+		while (tailRunning.load())
+		{
+			ConvolutionKernel* old = retired.exchange(nullptr, std::memory_order_acq_rel);
+			delete old;
+
+			uint64_t completed = tailCompleted.load(std::memory_order_relaxed);
+			if (completed < tailSubmitted.load(std::memory_order_acquire))
+			{
+				uint32_t slot = (uint32_t)(completed % kTailSlots);
+				const ConvolutionKernel* kernel = tailKernel[slot];
+				if (kernel && !previous)
+					tail.clear();
+				previous = kernel;
+
+				const float* const input[2] = { tailInput[slot][0].data(), tailInput[slot][1].data() };
+				float* const output[2] = { tailOutput[slot][0].data(), tailOutput[slot][1].data() };
+				tail.process(input, kernel ? &kernel->tail : nullptr, output);
+				tailCompleted.store(completed + 1, std::memory_order_release);
+			}
+			else
+				tailWakeup.wait(timeout);
+		}
+	}
+
+	/** loader thread: read, resample, normalize and partition the IR, then publish it */
+	void runLoader(std::string path, double targetRate)
+	{
+		std::vector<float> file[2];
+		uint32_t channels = 0;
+		double fileRate = 0.0;
+		if (!loadWaveFile(path, file[0], file[1], channels, fileRate) || loaderAbort.load())
+			return;
+
+		ConvolutionKernel* kernel = new ConvolutionKernel;
+		kernel->sampleRate = targetRate;
+
+		std::vector<float> impulse[2];
+		size_t maxLength = (size_t)(kMaxImpulse_Sec * targetRate);
+		for (uint32_t channel = 0; channel < 2 && !loaderAbort.load(); channel++)
+			resampleImpulse(file[channel], fileRate, targetRate, maxLength, impulse[channel]);
+
+		// --- unit energy in the louder channel
+		double energy = 0.0;
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			double sum = 0.0;
+			for (float h : impulse[channel])
+				sum += (double)h * h;
+			energy = std::max(energy, sum);
+		}
+		float normalize = energy > 0.0 ? (float)(1.0 / sqrt(energy)) : 0.0f;
+
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			std::vector<float>& h = impulse[channel];
+			for (uint32_t k = 0; k < kDirectLength; k++)
+				kernel->direct[channel][kDirectLength - 1 - k] = k < h.size() ? h[k] * normalize : 0.0f;
+		}
+		partition(impulse, normalize, kDirectLength, kBodyStart, head, kernel->head);
+		partition(impulse, normalize, kBodyStart, kTailStart, body, kernel->body);
+		partition(impulse, normalize, kTailStart, (size_t)-1, tail, kernel->tail);
+
+		if (loaderAbort.load())
+		{
+			delete kernel;
+			return;
+		}
+		delete pending.exchange(kernel, std::memory_order_acq_rel);
+	}
+
+	/** FFT the IR range [start, end) in blocks of the level's size into segment */
+	static void partition(const std::vector<float>* impulse, float normalize, size_t start, size_t end, const PartitionedConvolver& level, ConvolutionSegment& segment)
+	{
+		uint32_t blockSize = level.getBlockSize();
+		size_t length = std::min(end, std::max(impulse[0].size(), impulse[1].size()));
+		size_t partitions = length > start ? (length - start + blockSize - 1) / blockSize : 0;
+
+		segment.partitions = (uint32_t)std::min(partitions, (size_t)level.getMaxPartitions());
+		segment.stride = level.getStride();
+
+		RealFFT fft;
+		fft.initialize(2 * blockSize);
+		std::vector<float> block(2 * blockSize, 0.0f);
+
+		// --- fold the inverse FFT's 1/(N/2) into the spectra
+		float scale = normalize / blockSize;
+
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			const std::vector<float>& h = impulse[channel];
+			segment.spectra[channel].assign(2 * segment.stride * segment.partitions, 0.0f);
+
+			for (uint32_t p = 0; p < segment.partitions; p++)
+			{
+				// --- overlap-save kernel: the partition followed by blockSize zeros
+				std::fill(block.begin(), block.end(), 0.0f);
+				for (uint32_t k = 0; k < blockSize; k++)
+				{
+					size_t tap = start + (size_t)p * blockSize + k;
+					if (tap < h.size())
+						block[k] = h[tap] * scale;
+				}
+				float* spectrum = segment.spectra[channel].data() + 2 * segment.stride * p;
+				fft.forward(block.data(), spectrum, spectrum + segment.stride);
+			}
+		}
+	}
+
+	void stopThreads()
+	{
+		loaderAbort.store(true);
+		if (loader.joinable())
+			loader.join();
+
+		tailRunning.store(false);
+		tailWakeup.notify();
+		if (tailWorker.joinable())
+			tailWorker.join();
+	}
+
+	/** threads must be stopped */
+	void releaseKernels()
+	{
+		delete current;
+		delete pending.exchange(nullptr);
+		delete retired.exchange(nullptr);
+		current = nullptr;
+	}
+};
+
+#endif
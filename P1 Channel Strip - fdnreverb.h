@@ -0,0 +1,460 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip reverb:  fdnreverb.h
+//
+/**
+    \file   fdnreverb.h
+    \brief  feedback delay network reverb for the P1 Channel Strip
+    		- FDNReverb: 8 delay lines in one arena, Hadamard feedback matrix with SSE butterflies
+    		- measureReverbRT60( ): offline RT60 measurement from an impulse response
+*/
+// -----------------------------------------------------------------------------
+#ifndef __fdnReverb_h__
+#define __fdnReverb_h__
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FDN_SSE2 1
+#else
+#define FDN_SSE2 0
+#endif
+
+/**
+\struct FDNReverbParameters
+\ingroup P1-Objects
+\brief
+Custom parameter structure for the FDNReverb object.
+*/
+struct FDNReverbParameters
+{
+	FDNReverbParameters() {}
+
+	double size_mSec = 50.0;		///< longest delay line, clamped to [kMinSize_mSec, kMaxSize_mSec]
+	double rt60_Sec = 2.0;			///< decay time to -60 dB at low frequencies
+	double damping = 0.35;			///< one-pole lowpass coefficient in each line, 0 = bright, 0.9 = dark
+	double preDelay_mSec = 0.0;		///< predelay, clamped to [0, kMaxPreDelay_mSec]
+	double wetLevel_dB = -3.0;		///< output level
+};
+
+/**
+\class FDNReverb
+\ingroup P1-Objects
+\brief
+Stereo feedback delay network reverb. Input runs through a predelay and a short series allpass diffuser
+per channel, then into 8 delay lines whose outputs are damped, scaled for the requested RT60 and fed back
+through an 8x8 Hadamard matrix. The matrix is applied with three butterfly stages on two 4-lane SSE
+vectors (no multiplies except the final 1/sqrt(8)); all delay memory is one contiguous arena allocated in
+reset( ). Output is wet-only.
+
+Audio I/O:
+- processes stereo blocks, wet-only; input and output may not alias
+
+Control I/F:
+- Use FDNReverbParameters structure to get/set object params; the line lengths are rounded to primes so
+  that their echo patterns do not line up
+*/
+class FDNReverb
+{
+public:
+	static const uint32_t kNumLines = 8;
+	static const uint32_t kNumDiffusers = 4;
+
+	static constexpr double kMinSize_mSec = 10.0;
+	static constexpr double kMaxSize_mSec = 100.0;
+	static constexpr double kMaxPreDelay_mSec = 500.0;
+
+	FDNReverb() {}
+	~FDNReverb() {}
+
+	/** allocate the arena for the largest size and predelay at this sample rate and clear all state */
+	bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+
+		// --- arena layout: [lines][diffusers L][diffusers R][predelay L][predelay R]
+		uint32_t offset = 0;
+		uint32_t maxLine = (uint32_t)(kMaxSize_mSec * 0.001 * sampleRate) + 64;
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			lineOffset[line] = offset;
+			offset += maxLine;
+		}
+		for (uint32_t stage = 0; stage < kNumDiffusers; stage++)
+		{
+			diffuserLength[stage] = std::max(1u, (uint32_t)(kDiffuserTimes_mSec[stage] * 0.001 * sampleRate));
+			diffuserOffset[0][stage] = offset;
+			offset += diffuserLength[stage];
+			diffuserOffset[1][stage] = offset;
+			offset += diffuserLength[stage] + 7;	// --- slightly longer on the right for decorrelation
+		}
+		preDelaySize = (uint32_t)(kMaxPreDelay_mSec * 0.001 * sampleRate) + 1;
+		preDelayOffset = offset;
+		offset += 2 * preDelaySize;
+
+		arena.assign(offset, 0.0f);
+
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			linePosition[line] = 0;
+			lowpassState[line] = 0.0f;
+		}
+		for (uint32_t stage = 0; stage < kNumDiffusers; stage++)
+			diffuserPosition[0][stage] = diffuserPosition[1][stage] = 0;
+		preDelayWrite = 0;
+
+		calculateLines();
+		return true;
+	}
+
+	/** get parameters */
+	FDNReverbParameters getParameters() { return parameters; }
+
+	/** set parameters; line lengths and gains are only recalculated when something changed */
+	void setParameters(const FDNReverbParameters& _parameters)
+	{
+		bool changed = parameters.size_mSec != _parameters.size_mSec ||
+					   parameters.rt60_Sec != _parameters.rt60_Sec ||
+					   parameters.damping != _parameters.damping;
+		parameters = _parameters;
+
+		preDelaySamples = std::min((uint32_t)(std::max(parameters.preDelay_mSec, 0.0) * 0.001 * sampleRate), preDelaySize - 1);
+		wetGain = (float)(0.5 * pow(10.0, parameters.wetLevel_dB / 20.0));
+
+		if (changed)
+			calculateLines();
+	}
+
+	/** process a block; outputs are the wet signal only */
+	void processAudioBlock(const float* inputL, const float* inputR, float* outputL, float* outputR, uint32_t numFrames)
+	{
+		if (arena.empty())
+			return;
+
+		for (uint32_t start = 0; start < numFrames; start += kMaxBlockSize)
+		{
+			uint32_t count = std::min(numFrames - start, (uint32_t)kMaxBlockSize);
+			processChunk(inputL + start, inputR + start, outputL + start, outputR + start, count);
+		}
+
+		// --- once per block is enough to keep the loop filters out of the subnormal range
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			if (fabsf(lowpassState[line]) < 1.0e-15f)
+				lowpassState[line] = 0.0f;
+		}
+	}
+
+protected:
+	FDNReverbParameters parameters;
+	double sampleRate = 44100.0;
+
+	// --- relative line lengths (longest = 1), spread so no two are close to a simple ratio
+	const double kLineRatios[kNumLines] = { 0.405, 0.506, 0.561, 0.596, 0.727, 0.806, 0.926, 1.0 };
+	const double kDiffuserTimes_mSec[kNumDiffusers] = { 4.77, 3.59, 2.73, 1.73 };
+	static constexpr float kDiffuserGain = 0.6f;
+	const float kInputSigns[kNumLines] = { 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f };
+
+	std::vector<float> arena;
+
+	uint32_t lineOffset[kNumLines] = { 0 };
+	uint32_t lineLength[kNumLines] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+	uint32_t linePosition[kNumLines] = { 0 };
+	float lineGain[kNumLines] = { 0.0f };
+	float lowpassState[kNumLines] = { 0.0f };
+	float damping = 0.35f;
+
+	uint32_t diffuserOffset[2][kNumDiffusers] = { { 0 } };
+	uint32_t diffuserLength[kNumDiffusers] = { 1, 1, 1, 1 };
+	uint32_t diffuserPosition[2][kNumDiffusers] = { { 0 } };
+
+	uint32_t preDelayOffset = 0;
+	uint32_t preDelaySize = 1;
+	uint32_t preDelaySamples = 0;
+	uint32_t preDelayWrite = 0;
+
+	float wetGain = 0.5f;
+
+	// --- chunk scratch: line outputs/inputs frame-major, diffused input per channel
+	static const uint32_t kMaxBlockSize = 64;
+	float frames[kMaxBlockSize][kNumLines] = { { 0.0f } };
+	float diffusedL[kMaxBlockSize] = { 0.0f };
+	float diffusedR[kMaxBlockSize] = { 0.0f };
+
+	/** up to kMaxBlockSize frames. Every line is at least kMaxBlockSize long, so a whole chunk can be read
+		from the lines first, mixed frame by frame, and written back afterwards. */
+	void processChunk(const float* inputL, const float* inputR, float* outputL, float* outputR, uint32_t count)
+	{
+		float* memory = arena.data();
+		float* preL = memory + preDelayOffset;
+		float* preR = preL + preDelaySize;
+
+		// --- predelay and input diffusion
+		for (uint32_t i = 0; i < count; i++)
+		{
+			preL[preDelayWrite] = inputL[i];
+			preR[preDelayWrite] = inputR[i];
+			uint32_t read = preDelayWrite >= preDelaySamples ? preDelayWrite - preDelaySamples : preDelayWrite + preDelaySize - preDelaySamples;
+			diffusedL[i] = preL[read];
+			diffusedR[i] = preR[read];
+			if (++preDelayWrite == preDelaySize)
+				preDelayWrite = 0;
+		}
+		diffuse(0, diffusedL, count, memory);
+		diffuse(1, diffusedR, count, memory);
+
+		// --- read the chunk from every line, frame-major
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			const float* buffer = memory + lineOffset[line];
+			uint32_t position = linePosition[line];
+			for (uint32_t i = 0; i < count; i++)
+			{
+				frames[i][line] = buffer[position];
+				if (++position == lineLength[line])
+					position = 0;
+			}
+		}
+
+		// --- taps, then damping, decay gain and Hadamard feedback plus input, in place
+#if FDN_SSE2
+		__m128 lowpassA = _mm_loadu_ps(lowpassState);
+		__m128 lowpassB = _mm_loadu_ps(lowpassState + 4);
+#endif
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const float* lineOut = frames[i];
+
+			// --- stereo taps: even lines left, odd lines right, alternating signs
+			outputL[i] = wetGain * (lineOut[0] - lineOut[2] + lineOut[4] - lineOut[6]);
+			outputR[i] = wetGain * (lineOut[1] - lineOut[3] + lineOut[5] - lineOut[7]);
+
+#if FDN_SSE2
+			mixFeedback(frames[i], diffusedL[i], diffusedR[i], lowpassA, lowpassB);
+#else
+			mixFeedback(frames[i], diffusedL[i], diffusedR[i]);
+#endif
+		}
+#if FDN_SSE2
+		_mm_storeu_ps(lowpassState, lowpassA);
+		_mm_storeu_ps(lowpassState + 4, lowpassB);
+#endif
+
+		// --- write the chunk back
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			float* buffer = memory + lineOffset[line];
+			uint32_t position = linePosition[line];
+			for (uint32_t i = 0; i < count; i++)
+			{
+				buffer[position] = frames[i][line];
+				if (++position == lineLength[line])
+					position = 0;
+			}
+			linePosition[line] = position;
+		}
+	}
+
+	/** series Schroeder allpasses for one channel, in place over a chunk, one stage at a time */
+	void diffuse(uint32_t channel, float* x, uint32_t count, float* memory)
+	{
+		for (uint32_t stage = 0; stage < kNumDiffusers; stage++)
+		{
+			uint32_t length = diffuserLength[stage] + (channel ? 7 : 0);
+			float* buffer = memory + diffuserOffset[channel][stage];
+			uint32_t position = diffuserPosition[channel][stage];
+
+			for (uint32_t i = 0; i < count; i++)
+			{
+				float delayed = buffer[position];
+				float v = x[i] + kDiffuserGain * delayed;
+				buffer[position] = v;
+				x[i] = delayed - kDiffuserGain * v;
+
+				if (++position == length)
+					position = 0;
+			}
+			diffuserPosition[channel][stage] = position;
+		}
+	}
+
+	/** damping lowpass and RT60 gain per line, the normalized 8x8 Hadamard matrix, then the input;
+		frame holds the 8 line outputs on entry and the 8 line inputs on return */
+#if FDN_SSE2
+	inline void mixFeedback(float* frame, float inputL, float inputR, __m128& lowpassA, __m128& lowpassB)
+	{
+		const __m128 d = _mm_set1_ps(damping);
+		const __m128 oneMinusD = _mm_set1_ps(1.0f - damping);
+
+		lowpassA = _mm_add_ps(_mm_mul_ps(oneMinusD, _mm_loadu_ps(frame)), _mm_mul_ps(d, lowpassA));
+		lowpassB = _mm_add_ps(_mm_mul_ps(oneMinusD, _mm_loadu_ps(frame + 4)), _mm_mul_ps(d, lowpassB));
+
+		__m128 a = hadamard4(_mm_mul_ps(lowpassA, _mm_loadu_ps(lineGain)));
+		__m128 b = hadamard4(_mm_mul_ps(lowpassB, _mm_loadu_ps(lineGain + 4)));
+
+		// --- last butterfly across the two halves with the 1/sqrt(8) normalization, then the input:
+		//     even lines take left, odd lines take right, with the signs in kInputSigns
+		const __m128 norm = _mm_set1_ps(0.35355339f);
+		__m128 input = _mm_set_ps(inputR, inputL, inputR, inputL);
+		_mm_storeu_ps(frame, _mm_add_ps(_mm_mul_ps(_mm_add_ps(a, b), norm), _mm_mul_ps(input, _mm_loadu_ps(kInputSigns))));
+		_mm_storeu_ps(frame + 4, _mm_add_ps(_mm_mul_ps(_mm_sub_ps(a, b), norm), _mm_mul_ps(input, _mm_loadu_ps(kInputSigns + 4))));
+	}
+#else
+	inline void mixFeedback(float* frame, float inputL, float inputR)
+	{
+		float v[kNumLines];
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			lowpassState[line] = (1.0f - damping) * frame[line] + damping * lowpassState[line];
+			v[line] = lowpassState[line] * lineGain[line];
+		}
+
+		// --- in-place fast Walsh-Hadamard transform
+		for (uint32_t span = 1; span < kNumLines; span <<= 1)
+		{
+			for (uint32_t i = 0; i < kNumLines; i += 2 * span)
+			{
+				for (uint32_t j = i; j < i + span; j++)
+				{
+					float x = v[j];
+					float y = v[j + span];
+					v[j] = x + y;
+					v[j + span] = x - y;
+				}
+			}
+		}
+
+		for (uint32_t line = 0; line < kNumLines; line++)
+			frame[line] = v[line] * 0.35355339f + ((line & 1) ? inputR : inputL) * kInputSigns[line];
+	}
+#endif
+
+#if FDN_SSE2
+	/** 4-point Walsh-Hadamard transform inside one vector: two butterfly stages */
+	static inline __m128 hadamard4(__m128 x)
+	{
+		// --- (0,1) and (2,3)
+		__m128 even = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 2, 0, 0));
+		__m128 odd = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 1, 1));
+		x = _mm_add_ps(even, _mm_mul_ps(odd, _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f)));
+
+		// --- (0,2) and (1,3)
+		__m128 low = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 1, 0));
+		__m128 high = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 2, 3, 2));
+		return _mm_add_ps(low, _mm_mul_ps(high, _mm_set_ps(-1.0f, -1.0f, 1.0f, 1.0f)));
+	}
+#endif
+
+	static bool isPrime(uint32_t n)
+	{
+		if (n < 2)
+			return false;
+		for (uint32_t k = 2; k * k <= n; k++)
+		{
+			if (n % k == 0)
+				return false;
+		}
+		return true;
+	}
+
+	/** line lengths (rounded up to primes), per-line RT60 gains and damping */
+	void calculateLines()
+	{
+		double size_mSec = std::min(std::max(parameters.size_mSec, (double)kMinSize_mSec), (double)kMaxSize_mSec);
+		double rt60 = std::max(parameters.rt60_Sec, 0.05);
+		uint32_t maxLine = (uint32_t)(kMaxSize_mSec * 0.001 * sampleRate) + 64;
+
+		for (uint32_t line = 0; line < kNumLines; line++)
+		{
+			// --- never shorter than a chunk; see processChunk( )
+			uint32_t length = std::max(kMaxBlockSize + 1, (uint32_t)(kLineRatios[line] * size_mSec * 0.001 * sampleRate));
+			while (!isPrime(length) && length < maxLine)
+				length++;
+
+			lineLength[line] = std::min(length, maxLine);
+			if (linePosition[line] >= lineLength[line])
+				linePosition[line] = 0;
+
+			// --- -60 dB after rt60 seconds: g = 10^(-3 * length / (fs * rt60))
+			lineGain[line] = (float)pow(10.0, -3.0 * lineLength[line] / (sampleRate * rt60));
+		}
+
+		damping = (float)std::min(std::max(parameters.damping, 0.0), 0.9);
+	}
+};
+
+/**
+\brief offline RT60 measurement: renders the impulse response of a stereo block processor, builds the
+Schroeder backward-integrated energy decay curve and extrapolates the -5 dB to -35 dB slope (T30) to
+60 dB. Allocates; not for the audio thread.
+
+\param reverb any object with processAudioBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t n)
+       that outputs the wet signal; it should be freshly reset
+\param sampleRate sample rate the reverb was reset with
+\param maxSeconds length of the rendered impulse response
+
+\return RT60 in seconds, or 0 if the decay never reached -35 dB
+*/
+template <typename Reverb>
+double measureReverbRT60(Reverb& reverb, double sampleRate, double maxSeconds = 12.0)
+{
+	const uint32_t kBlock = 64;
+	uint32_t length = (uint32_t)(maxSeconds * sampleRate);
+	std::vector<double> energy(length, 0.0);
+
+	float inL[kBlock], inR[kBlock], outL[kBlock], outR[kBlock];
+	for (uint32_t start = 0; start < length; start += kBlock)
+	{
+		uint32_t count = std::min(kBlock, length - start);
+		std::fill(inL, inL + kBlock, 0.0f);
+		std::fill(inR, inR + kBlock, 0.0f);
+		if (start == 0)
+			inL[0] = inR[0] = 1.0f;
+
+		reverb.processAudioBlock(inL, inR, outL, outR, count);
+		for (uint32_t i = 0; i < count; i++)
+			energy[start + i] = (double)outL[i] * outL[i] + (double)outR[i] * outR[i];
+	}
+
+	// --- Schroeder integral, in dB relative to the total energy
+	std::vector<double> decay_dB(length, -300.0);
+	double remaining = 0.0;
+	for (uint32_t i = length; i-- > 0;)
+	{
+		remaining += energy[i];
+		decay_dB[i] = remaining;
+	}
+	double total = decay_dB[0];
+	if (total <= 0.0)
+		return 0.0;
+	for (uint32_t i = 0; i < length; i++)
+		decay_dB[i] = decay_dB[i] > 0.0 ? 10.0 * log10(decay_dB[i] / total) : -300.0;
+
+	// --- least-squares line through the -5..-35 dB part of the curve
+	double sumT = 0.0, sumD = 0.0, sumTT = 0.0, sumTD = 0.0;
+	uint32_t points = 0;
+	for (uint32_t i = 0; i < length; i++)
+	{
+		if (decay_dB[i] > -5.0)
+			continue;
+		if (decay_dB[i] < -35.0)
+			break;
+
+		double t = i / sampleRate;
+		sumT += t;
+		sumD += decay_dB[i];
+		sumTT += t * t;
+		sumTD += t * decay_dB[i];
+		points++;
+	}
+	if (points < 2 || decay_dB[length - 1] > -35.0)
+		return 0.0;
+
+	double slope = (points * sumTD - sumT * sumD) / (points * sumTT - sumT * sumT);	// dB per second
+	return slope < 0.0 ? -60.0 / slope : 0.0;
+}
+
+#endif
@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip lock-free helpers:  lockfree.h
+//
+/**
+    \file   lockfree.h
+    \brief  wait-free containers for handing data between the audio thread and worker/GUI threads
+    		- TripleBuffer: latest-value exchange between one writer and one reader
+    		- SpscRing: bounded FIFO between one producer and one consumer
+    		- WorkerWakeup: lets the audio thread wake a sleeping worker without blocking
+*/
+// -----------------------------------------------------------------------------
+#ifndef __lockFree_h__
+#define __lockFree_h__
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/**
+\class TripleBuffer
+\ingroup P1-Objects
+\brief
+Single-writer, single-reader triple buffer. The writer fills getWriteBuffer( ) and calls publish( );
+the reader calls update( ) and, if it returns true, reads the newest value from getReadBuffer( ).
+Neither side ever blocks or waits: each owns one slot, and the third slot is swapped through a single
+atomic. Intermediate values are dropped if the writer publishes faster than the reader updates, so this
+is for state (coefficients, meter snapshots), not for streams.
+
+- T must be copyable; the buffers are allocated inline, so there is no allocation after construction
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+	TripleBuffer() {}
+	~TripleBuffer() {}
+
+	TripleBuffer(const TripleBuffer&) = delete;
+	TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+	// --- writer side
+	/** the slot owned by the writer; fill it, then publish( ) */
+	T& getWriteBuffer() { return buffers[writeIndex]; }
+
+	/** make the write slot the newest value; the writer gets the previous middle slot back */
+	void publish()
+	{
+		writeIndex = middle.exchange(uint8_t(writeIndex | kNewData), std::memory_order_acq_rel) & kIndexMask;
+	}
+
+	// --- reader side
+	/** take the newest published value, if any; returns true when getReadBuffer( ) changed */
+	bool update()
+	{
+		if ((middle.load(std::memory_order_relaxed) & kNewData) == 0)
+			return false;
+
+		readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & kIndexMask;
+		return true;
+	}
+
+	/** the slot owned by the reader */
+	const T& getReadBuffer() const { return buffers[readIndex]; }
+
+private:
+	static const uint8_t kIndexMask = 0x03;
+	static const uint8_t kNewData = 0x04;
+
+	T buffers[3];
+	std::atomic<uint8_t> middle{ 1 };
+	uint8_t writeIndex = 0;
+	uint8_t readIndex = 2;
+};
+
+/**
+\class SpscRing
+\ingroup P1-Objects
+\brief
+Single-producer, single-consumer ring of kCapacity items (a power of two). push( ) and pop( ) copy one
+item and never block; push( ) returns false when the ring is full and the item is dropped, so the
+producer decides what a full ring means (count it, retry next block). Unlike TripleBuffer every pushed
+item is delivered, in order, which makes this the container for streams: per-block records, audio.
+Large items can be filled in place with beginWrite( )/commitWrite( ) to avoid a staging copy.
+
+- the two indices never share a cache line, and each side caches the other's index, so the
+  shared lines are only touched when the cached value says the ring looks full (producer) or empty
+  (consumer)
+- items are stored inline; there is no allocation after construction
+*/
+template <typename T, uint32_t kCapacity>
+class SpscRing
+{
+	static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+	SpscRing() {}
+	~SpscRing() {}
+
+	SpscRing(const SpscRing&) = delete;
+	SpscRing& operator=(const SpscRing&) = delete;
+
+	// --- producer side
+	/** copy an item in; returns false (and drops it) if the ring is full */
+	bool push(const T& item)
+	{
+		uint32_t head = writeIndex.load(std::memory_order_relaxed);
+		if (head - cachedReadIndex == kCapacity)
+		{
+			cachedReadIndex = readIndex.load(std::memory_order_acquire);
+			if (head - cachedReadIndex == kCapacity)
+				return false;
+		}
+
+		items[head & kIndexMask] = item;
+		writeIndex.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** in-place alternative to push( ): the free slot to fill, or nullptr if the ring is full; the
+		item is only visible to the consumer after commitWrite( ) */
+	T* beginWrite()
+	{
+		uint32_t head = writeIndex.load(std::memory_order_relaxed);
+		if (head - cachedReadIndex == kCapacity)
+		{
+			cachedReadIndex = readIndex.load(std::memory_order_acquire);
+			if (head - cachedReadIndex == kCapacity)
+				return nullptr;
+		}
+		return &items[head & kIndexMask];
+	}
+
+	/** publish the slot returned by beginWrite( ) */
+	void commitWrite()
+	{
+		writeIndex.store(writeIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	// --- consumer side
+	/** copy the oldest item out; returns false if the ring is empty */
+	bool pop(T& item)
+	{
+		uint32_t tail = readIndex.load(std::memory_order_relaxed);
+		if (tail == cachedWriteIndex)
+		{
+			cachedWriteIndex = writeIndex.load(std::memory_order_acquire);
+			if (tail == cachedWriteIndex)
+				return false;
+		}
+
+		item = items[tail & kIndexMask];
+		readIndex.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** consumer side: drop everything currently queued */
+	void clear()
+	{
+		cachedWriteIndex = writeIndex.load(std::memory_order_acquire);
+		readIndex.store(cachedWriteIndex, std::memory_order_release);
+	}
+
+private:
+	static const uint32_t kIndexMask = kCapacity - 1;
+	static const uint32_t kCacheLine = 64;
+
+	// --- each side's index pair is fenced by a full line of padding rather than aligned, so the ring
+	//     (and whatever embeds it) needs no over-aligned allocation
+	char padProducer[kCacheLine];
+
+	// --- producer's pair: its index and its copy of the consumer's
+	std::atomic<uint32_t> writeIndex{ 0 };
+	uint32_t cachedReadIndex = 0;
+	char padConsumer[kCacheLine];
+
+	// --- consumer's pair
+	std::atomic<uint32_t> readIndex{ 0 };
+	uint32_t cachedWriteIndex = 0;
+	char padItems[kCacheLine];
+
+	T items[kCapacity];
+};
+
+/**
+\class WorkerWakeup
+\ingroup P1-Objects
+\brief
+Sleep/wake for a worker thread fed through TripleBuffer or SpscRing. The worker blocks in wait( ) on a
+condition variable instead of polling; notify( ) sets an atomic flag and calls notify_one( ) without
+taking the mutex, so it never blocks and may be called from the audio thread.
+
+Because the notifier does not hold the mutex, a notification that lands between the worker's flag check
+and its going to sleep is not delivered. The flag stays set, and the timeout passed to wait( ) bounds how
+late the worker sees it in that case; the timeout is a safety net, not the normal response time.
+
+- wait( ) clears the flag before it returns, so the worker must drain all pending work after each wake
+*/
+class WorkerWakeup
+{
+public:
+	WorkerWakeup() {}
+	~WorkerWakeup() {}
+
+	WorkerWakeup(const WorkerWakeup&) = delete;
+	WorkerWakeup& operator=(const WorkerWakeup&) = delete;
+
+	/** any thread, real-time safe: wake the worker */
+	void notify()
+	{
+		signalled.store(true, std::memory_order_release);
+		condition.notify_one();
+	}
+
+	/** worker: sleep until notify( ) or the timeout; returns true if notified */
+	bool wait(std::chrono::microseconds timeout)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		bool notified = condition.wait_for(lock, timeout, [this] { return signalled.load(std::memory_order_acquire); });
+		signalled.store(false, std::memory_order_relaxed);
+		return notified;
+	}
+
+private:
+	std::atomic<bool> signalled{ false };
+	std::mutex mutex;
+	std::condition_variable condition;
+};
+
+#endif
@@ -0,0 +1,480 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip metering:  loudness.h
+//
+/**
+    \file   loudness.h
+    \brief  ITU-R BS.1770-4 loudness and true-peak metering for the P1 Channel Strip output
+    		- KWeightingFilter: BS.1770 pre-filter + RLB high-pass, both channels in one vector
+    		- TruePeakDetector: 4x polyphase oversampled peak, all four phases in one vector
+    		- LoudnessMeter: momentary, short-term and gated integrated loudness plus true peak;
+    		  publishes a LoudnessSnapshot through a TripleBuffer
+*/
+// -----------------------------------------------------------------------------
+#ifndef __loudness_h__
+#define __loudness_h__
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include "lockfree.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LOUD_SSE2 1
+#else
+#define LOUD_SSE2 0
+#endif
+
+/**
+\class KWeightingFilter
+\ingroup P1-Objects
+\brief
+BS.1770 K-weighting: the high-shelf pre-filter followed by the RLB high-pass, designed for any sample
+rate (the 48 kHz coefficients of the recommendation are reproduced exactly). Left and right run in the
+two lanes of one double vector; processAudioBlock( ) returns the per-channel sums of squares of the
+filtered block, which is all the loudness gating needs.
+*/
+class KWeightingFilter
+{
+public:
+	KWeightingFilter() {}
+	~KWeightingFilter() {}
+
+	/** design both stages for the sample rate and clear the state */
+	void reset(double sampleRate)
+	{
+		// --- stage 1: high shelf, +4 dB above ~1.7 kHz
+		double K = tan(3.14159265358979323846 * 1681.974450955533 / sampleRate);
+		double Q = 0.7071752369554196;
+		double Vh = pow(10.0, 3.999843853973347 / 20.0);
+		double Vb = pow(Vh, 0.4996667741545416);
+		double a0 = 1.0 + K / Q + K * K;
+		shelf[0] = (Vh + Vb * K / Q + K * K) / a0;
+		shelf[1] = 2.0 * (K * K - Vh) / a0;
+		shelf[2] = (Vh - Vb * K / Q + K * K) / a0;
+		shelf[3] = 2.0 * (K * K - 1.0) / a0;
+		shelf[4] = (1.0 - K / Q + K * K) / a0;
+
+		// --- stage 2: RLB high-pass at ~38 Hz; its numerator is exactly 1, -2, 1
+		K = tan(3.14159265358979323846 * 38.13547087602444 / sampleRate);
+		Q = 0.5003270373238773;
+		a0 = 1.0 + K / Q + K * K;
+		highpass[0] = 1.0;
+		highpass[1] = -2.0;
+		highpass[2] = 1.0;
+		highpass[3] = 2.0 * (K * K - 1.0) / a0;
+		highpass[4] = (1.0 - K / Q + K * K) / a0;
+
+		std::fill(state, state + 8, 0.0);
+	}
+
+	/** filter a block and add the per-channel sums of squares to sumL/sumR */
+	void processAudioBlock(const float* left, const float* right, uint32_t numFrames, double& sumL, double& sumR)
+	{
+#if LOUD_SSE2
+		const __m128d sa0 = _mm_set1_pd(shelf[0]), sa1 = _mm_set1_pd(shelf[1]), sa2 = _mm_set1_pd(shelf[2]);
+		const __m128d sb1 = _mm_set1_pd(shelf[3]), sb2 = _mm_set1_pd(shelf[4]);
+		const __m128d hb1 = _mm_set1_pd(highpass[3]), hb2 = _mm_set1_pd(highpass[4]);
+		const __m128d two = _mm_set1_pd(2.0);
+
+		__m128d s1 = _mm_loadu_pd(state);
+		__m128d s2 = _mm_loadu_pd(state + 2);
+		__m128d h1 = _mm_loadu_pd(state + 4);
+		__m128d h2 = _mm_loadu_pd(state + 6);
+		__m128d sum = _mm_setzero_pd();
+
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			// --- transposed direct form II, both channels per instruction
+			__m128d x = _mm_set_pd(right[i], left[i]);
+			__m128d y = _mm_add_pd(_mm_mul_pd(sa0, x), s1);
+			s1 = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(sa1, x), _mm_mul_pd(sb1, y)), s2);
+			s2 = _mm_sub_pd(_mm_mul_pd(sa2, x), _mm_mul_pd(sb2, y));
+
+			__m128d z = _mm_add_pd(y, h1);
+			h1 = _mm_add_pd(_mm_sub_pd(h2, _mm_mul_pd(two, y)), _mm_sub_pd(_mm_setzero_pd(), _mm_mul_pd(hb1, z)));
+			h2 = _mm_sub_pd(y, _mm_mul_pd(hb2, z));
+
+			sum = _mm_add_pd(sum, _mm_mul_pd(z, z));
+		}
+
+		// --- flush subnormal state once per block
+		const __m128d tiny = _mm_set1_pd(1.0e-30);
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		s1 = _mm_and_pd(_mm_cmpge_pd(_mm_andnot_pd(signMask, s1), tiny), s1);
+		s2 = _mm_and_pd(_mm_cmpge_pd(_mm_andnot_pd(signMask, s2), tiny), s2);
+		h1 = _mm_and_pd(_mm_cmpge_pd(_mm_andnot_pd(signMask, h1), tiny), h1);
+		h2 = _mm_and_pd(_mm_cmpge_pd(_mm_andnot_pd(signMask, h2), tiny), h2);
+
+		_mm_storeu_pd(state, s1);
+		_mm_storeu_pd(state + 2, s2);
+		_mm_storeu_pd(state + 4, h1);
+		_mm_storeu_pd(state + 6, h2);
+
+		double sums[2];
+		_mm_storeu_pd(sums, sum);
+		sumL += sums[0];
+		sumR += sums[1];
+#else
+		const float* input[2] = { left, right };
+		double* sums[2] = { &sumL, &sumR };
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			double s1 = state[channel], s2 = state[2 + channel];
+			double h1 = state[4 + channel], h2 = state[6 + channel];
+			double sum = 0.0;
+			for (uint32_t i = 0; i < numFrames; i++)
+			{
+				double x = input[channel][i];
+				double y = shelf[0] * x + s1;
+				s1 = shelf[1] * x - shelf[3] * y + s2;
+				s2 = shelf[2] * x - shelf[4] * y;
+
+				double z = y + h1;
+				h1 = -2.0 * y - highpass[3] * z + h2;
+				h2 = y - highpass[4] * z;
+				sum += z * z;
+			}
+			state[channel] = fabs(s1) < 1.0e-30 ? 0.0 : s1;
+			state[2 + channel] = fabs(s2) < 1.0e-30 ? 0.0 : s2;
+			state[4 + channel] = fabs(h1) < 1.0e-30 ? 0.0 : h1;
+			state[6 + channel] = fabs(h2) < 1.0e-30 ? 0.0 : h2;
+			*sums[channel] += sum;
+		}
+#endif
+	}
+
+protected:
+	double shelf[5] = { 1.0, 0.0, 0.0, 0.0, 0.0 };		///< { a0, a1, a2, b1, b2 }, TDF-II
+	double highpass[5] = { 1.0, -2.0, 1.0, 0.0, 0.0 };
+	double state[8] = { 0.0 };							///< { s1 L/R, s2 L/R, h1 L/R, h2 L/R }
+};
+
+/**
+\class TruePeakDetector
+\ingroup P1-Objects
+\brief
+Inter-sample peak detector: 4x polyphase interpolation with a 48-tap Kaiser-windowed sinc (12 taps per
+phase), as in BS.1770-4 Annex 2. The taps are stored transposed, one four-phase vector per input tap, so
+each input sample produces all four interpolated samples with 12 multiply-adds of one vector. Phase 0
+reproduces the input sample exactly, so the true peak is never below the sample peak.
+
+- the detector does not attenuate the input first (no 12 dB headroom is needed in floating point)
+*/
+class TruePeakDetector
+{
+public:
+	TruePeakDetector()
+	{
+		// --- h[n] = sinc((n - 24) / 4) * kaiser(n), n = 0..47; phase p uses h[4j + p]
+		const double beta = 7.0;
+		auto bessel0 = [](double x)
+		{
+			double sum = 1.0, term = 1.0;
+			for (int k = 1; k < 40; k++)
+			{
+				term *= (x / (2.0 * k)) * (x / (2.0 * k));
+				sum += term;
+			}
+			return sum;
+		};
+
+		double h[kNumTaps] = { 0.0 };
+		for (uint32_t n = 0; n < kNumTaps; n++)
+		{
+			double t = ((double)n - 24.0) / 4.0;
+			double sinc = t == 0.0 ? 1.0 : sin(3.14159265358979323846 * t) / (3.14159265358979323846 * t);
+			double r = ((double)n - 24.0) / 24.0;
+			h[n] = sinc * bessel0(beta * sqrt(std::max(0.0, 1.0 - r * r))) / bessel0(beta);
+		}
+
+		// --- unity DC gain per phase; newest sample first in each phase
+		for (uint32_t phase = 0; phase < kFactor; phase++)
+		{
+			double sum = 0.0;
+			for (uint32_t j = 0; j < kTapsPerPhase; j++)
+				sum += h[kFactor * j + phase];
+			for (uint32_t j = 0; j < kTapsPerPhase; j++)
+				taps[j][phase] = (float)(h[kFactor * j + phase] / sum);
+		}
+		reset();
+	}
+	~TruePeakDetector() {}
+
+	static const uint32_t kFactor = 4;
+	static const uint32_t kTapsPerPhase = 12;
+	static const uint32_t kNumTaps = kFactor * kTapsPerPhase;
+
+	/** clear the history */
+	void reset()
+	{
+		std::fill(history, history + 2 * kTapsPerPhase, 0.0f);
+		index = 0;
+	}
+
+	/** interpolate a block and return the largest absolute interpolated value */
+	float processAudioBlock(const float* input, uint32_t numFrames)
+	{
+		uint32_t at = index;
+#if LOUD_SSE2
+		__m128 peak = _mm_setzero_ps();
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			// --- doubled ring: the newest kTapsPerPhase inputs are contiguous, newest first
+			at = at == 0 ? kTapsPerPhase - 1 : at - 1;
+			history[at] = history[at + kTapsPerPhase] = input[i];
+			const float* x = history + at;
+
+			__m128 acc = _mm_mul_ps(_mm_loadu_ps(taps[0]), _mm_set1_ps(x[0]));
+			for (uint32_t j = 1; j < kTapsPerPhase; j++)
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(taps[j]), _mm_set1_ps(x[j])));
+
+			peak = _mm_max_ps(peak, _mm_andnot_ps(signMask, acc));
+		}
+		float lanes[4];
+		_mm_storeu_ps(lanes, peak);
+		float result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#else
+		float result = 0.0f;
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			at = at == 0 ? kTapsPerPhase - 1 : at - 1;
+			history[at] = history[at + kTapsPerPhase] = input[i];
+			const float* x = history + at;
+
+			for (uint32_t phase = 0; phase < kFactor; phase++)
+			{
+				float acc = 0.0f;
+				for (uint32_t j = 0; j < kTapsPerPhase; j++)
+					acc += taps[j][phase] * x[j];
+				result = std::max(result, fabsf(acc));
+			}
+		}
+#endif
+		index = at;
+		return result;
+	}
+
+protected:
+	float taps[kTapsPerPhase][kFactor];			///< transposed: taps[j] holds tap j of phases 0..3
+	float history[2 * kTapsPerPhase];
+	uint32_t index = 0;
+};
+
+/**
+\struct LoudnessSnapshot
+\ingroup P1-Objects
+\brief
+One published set of meter readings; levels below the floor read kMeterFloor.
+*/
+struct LoudnessSnapshot
+{
+	LoudnessSnapshot() {}
+
+	static constexpr double kMeterFloor = -120.0;
+
+	double momentary_LUFS = kMeterFloor;		///< 400 ms window
+	double shortTerm_LUFS = kMeterFloor;		///< 3 s window
+	double integrated_LUFS = kMeterFloor;		///< gated (-70 LUFS absolute, -10 LU relative) since reset
+	double truePeak_dBTP[2] = { kMeterFloor, kMeterFloor };	///< per channel, over the last 100 ms
+	double truePeakMax_dBTP = kMeterFloor;		///< both channels, since reset
+	uint32_t sequence = 0;						///< increments with every publish
+};
+
+/**
+\class LoudnessMeter
+\ingroup P1-Objects
+\brief
+BS.1770-4 / EBU R128 meter for a stereo signal. The K-weighted energy is accumulated in 100 ms steps;
+momentary and short-term loudness are the means of the last 4 and 30 steps. Every step also closes a
+400 ms gating block (75 % overlap) that goes into a fixed histogram of 0.1 LU bins from -70 to +10
+LUFS holding a count and an energy sum per bin, so the two-stage gate is evaluated over 800 bins no
+matter how long the program runs. The relative gate is applied with bin resolution (blocks within
+0.1 LU of the gate may be counted on either side).
+
+After every step a LoudnessSnapshot is written to a TripleBuffer; the audio thread never waits or
+allocates, and a reader (GUI timer) calls getSnapshot( ) for the newest one.
+
+Audio I/O:
+- reads stereo blocks; does not modify the audio
+
+Control I/F:
+- reset( ) clears everything, including the integrated reading and the true-peak hold
+*/
+class LoudnessMeter
+{
+public:
+	LoudnessMeter() {}
+	~LoudnessMeter() {}
+
+	static const uint32_t kMomentarySteps = 4;
+	static const uint32_t kShortTermSteps = 30;
+	static const uint32_t kNumBins = 800;
+
+	/** set the sample rate and clear all readings */
+	void reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		stepLength = std::max((uint32_t)(0.1 * sampleRate + 0.5), 1u);
+		stepCount = 0;
+		stepSumL = stepSumR = 0.0;
+
+		kWeighting.reset(sampleRate);
+		truePeakL.reset();
+		truePeakR.reset();
+		stepPeakL = stepPeakR = 0.0f;
+		peakHold = 0.0f;
+
+		std::fill(stepEnergy, stepEnergy + kShortTermSteps, 0.0);
+		stepIndex = 0;
+		stepsDone = 0;
+		std::fill(binCount, binCount + kNumBins, 0u);
+		std::fill(binEnergy, binEnergy + kNumBins, 0.0);
+		sequence = 0;
+	}
+
+	/** meter a block; pass the same pointer twice for a mono signal */
+	void processAudioBlock(const float* left, const float* right, uint32_t numFrames)
+	{
+		uint32_t done = 0;
+		while (done < numFrames)
+		{
+			uint32_t count = std::min(numFrames - done, stepLength - stepCount);
+
+			// --- a mono signal (right == left) counts once, as BS.1770 weights a single channel
+			double sumR = 0.0;
+			kWeighting.processAudioBlock(left + done, right + done, count, stepSumL, sumR);
+			if (right != left)
+				stepSumR += sumR;
+			stepPeakL = std::max(stepPeakL, truePeakL.processAudioBlock(left + done, count));
+			stepPeakR = std::max(stepPeakR, truePeakR.processAudioBlock(right + done, count));
+
+			stepCount += count;
+			done += count;
+			if (stepCount == stepLength)
+				finishStep();
+		}
+	}
+
+	/** reader side: copy the newest snapshot; returns false if nothing new was published */
+	bool getSnapshot(LoudnessSnapshot& snapshot)
+	{
+		if (!snapshots.update())
+			return false;
+		snapshot = snapshots.getReadBuffer();
+		return true;
+	}
+
+protected:
+	double sampleRate = 44100.0;
+	KWeightingFilter kWeighting;
+	TruePeakDetector truePeakL;
+	TruePeakDetector truePeakR;
+
+	// --- current 100 ms step
+	uint32_t stepLength = 4410;
+	uint32_t stepCount = 0;
+	double stepSumL = 0.0;
+	double stepSumR = 0.0;
+	float stepPeakL = 0.0f;
+	float stepPeakR = 0.0f;
+	float peakHold = 0.0f;
+
+	// --- mean-square energy (channel sum) of the last kShortTermSteps steps
+	double stepEnergy[kShortTermSteps] = { 0.0 };
+	uint32_t stepIndex = 0;
+	uint32_t stepsDone = 0;
+
+	// --- gating histogram: bin b holds blocks from -70 + 0.1 b to -70 + 0.1 (b + 1) LUFS
+	uint32_t binCount[kNumBins] = { 0 };
+	double binEnergy[kNumBins] = { 0.0 };
+
+	TripleBuffer<LoudnessSnapshot> snapshots;
+	uint32_t sequence = 0;
+
+	static double toLUFS(double energy) { return energy > 0.0 ? std::max(-0.691 + 10.0 * log10(energy), (double)LoudnessSnapshot::kMeterFloor) : LoudnessSnapshot::kMeterFloor; }
+	static double toDB(float peak) { return peak > 0.0f ? std::max(20.0 * log10((double)peak), (double)LoudnessSnapshot::kMeterFloor) : LoudnessSnapshot::kMeterFloor; }
+
+	/** close a 100 ms step: update the windows and the histogram, then publish */
+	void finishStep()
+	{
+		stepEnergy[stepIndex] = (stepSumL + stepSumR) / (double)stepLength;
+		stepIndex = (stepIndex + 1) % kShortTermSteps;
+		stepsDone++;
+		stepCount = 0;
+		stepSumL = stepSumR = 0.0;
+
+		double momentary = meanEnergy(kMomentarySteps);
+		double shortTerm = meanEnergy(kShortTermSteps);
+
+		// --- every full 400 ms window is a gating block; absolute gate at -70 LUFS
+		if (stepsDone >= kMomentarySteps)
+		{
+			double blockLoudness = toLUFS(momentary);
+			if (blockLoudness >= -70.0)
+			{
+				uint32_t bin = std::min((uint32_t)((blockLoudness + 70.0) * 10.0), kNumBins - 1);
+				binCount[bin]++;
+				binEnergy[bin] += momentary;
+			}
+		}
+
+		peakHold = std::max(peakHold, std::max(stepPeakL, stepPeakR));
+
+		LoudnessSnapshot& snapshot = snapshots.getWriteBuffer();
+		snapshot.momentary_LUFS = stepsDone >= kMomentarySteps ? toLUFS(momentary) : LoudnessSnapshot::kMeterFloor;
+		snapshot.shortTerm_LUFS = stepsDone >= kShortTermSteps ? toLUFS(shortTerm) : LoudnessSnapshot::kMeterFloor;
+		snapshot.integrated_LUFS = integratedLoudness();
+		snapshot.truePeak_dBTP[0] = toDB(stepPeakL);
+		snapshot.truePeak_dBTP[1] = toDB(stepPeakR);
+		snapshot.truePeakMax_dBTP = toDB(peakHold);
+		snapshot.sequence = ++sequence;
+		snapshots.publish();
+
+		stepPeakL = stepPeakR = 0.0f;
+	}
+
+	/** mean of the newest steps (the window is shorter until enough steps have been seen) */
+	double meanEnergy(uint32_t steps)
+	{
+		uint32_t available = std::min(steps, stepsDone);
+		if (available == 0)
+			return 0.0;
+
+		double sum = 0.0;
+		for (uint32_t k = 1; k <= available; k++)
+			sum += stepEnergy[(stepIndex + kShortTermSteps - k) % kShortTermSteps];
+		return sum / available;
+	}
+
+	/** two-stage gated mean over the histogram */
+	double integratedLoudness()
+	{
+		uint64_t count = 0;
+		double energy = 0.0;
+		for (uint32_t bin = 0; bin < kNumBins; bin++)
+		{
+			count += binCount[bin];
+			energy += binEnergy[bin];
+		}
+		if (count == 0)
+			return LoudnessSnapshot::kMeterFloor;
+
+		// --- relative gate 10 LU below the absolute-gated mean; a bin counts if its lower edge clears it
+		double gate = toLUFS(energy / count) - 10.0;
+		uint32_t firstBin = (uint32_t)std::max(0.0, ceil((gate + 70.0) * 10.0 - 1.0e-9));
+
+		count = 0;
+		energy = 0.0;
+		for (uint32_t bin = firstBin; bin < kNumBins; bin++)
+		{
+			count += binCount[bin];
+			energy += binEnergy[bin];
+		}
+		return count > 0 ? toLUFS(energy / count) : LoudnessSnapshot::kMeterFloor;
+	}
+};
+
+#endif
@@ -1,1226 +1,2776 @@
-// -----------------------------------------------------------------------------
-//    ASPiK Plugin Kernel File:  plugincore.cpp
-//
-/**
-    \file   plugincore.cpp
-    \author Will Pirkle
-    \date   17-September-2018
-    \brief  Implementation file for PluginCore object
-    		- http://www.aspikplugins.com
-    		- http://www.willpirkle.com
-*/
-// -----------------------------------------------------------------------------
-#include "plugincore.h"
-#include "plugindescription.h"
-
-/**
-\brief PluginCore constructor is launching pad for object initialization
-
-Operations:
-- initialize the plugin description (strings, codes, numbers, see initPluginDescriptors())
-- setup the plugin's audio I/O channel support
-- create the PluginParameter objects that represent the plugin parameters (see FX book if needed)
-- create the presets
-*/
-PluginCore::PluginCore()
-{
-    // --- describe the plugin; call the helper to init the static parts you setup in plugindescription.h
-    initPluginDescriptors();
-
-    // --- default I/O combinations
-	// --- for FX plugins
-	if (getPluginType() == kFXPlugin)
-	{
-		addSupportedIOCombination({ kCFMono, kCFMono });
-		addSupportedIOCombination({ kCFMono, kCFStereo });
-		addSupportedIOCombination({ kCFStereo, kCFStereo });
-	}
-	else // --- synth plugins have no input, only output
-	{
-		addSupportedIOCombination({ kCFNone, kCFMono });
-		addSupportedIOCombination({ kCFNone, kCFStereo });
-	}
-
-	// --- for sidechaining, we support mono and stereo inputs; auxOutputs reserved for future use
-	addSupportedAuxIOCombination({ kCFMono, kCFNone });
-	addSupportedAuxIOCombination({ kCFStereo, kCFNone });
-
-	// --- create the parameters
-    initPluginParameters();
-
-    // --- create the presets
-    initPluginPresets();
-}
-
-/**
-\brief create all of your plugin parameters here
-
-\return true if parameters were created, false if they already existed
-*/
-bool PluginCore::initPluginParameters()
-{
-	if (pluginParameterMap.size() > 0)
-		return false;
-
-    // --- Add your plugin parameter instantiation code bewtween these hex codes
-	// **--0xDEA7--**
-
-
-	// --- Declaration of Plugin Parameter Objects 
-	PluginParameter* piParam = nullptr;
-
-	// --- continuous control: Box Gain
-	piParam = new PluginParameter(controlID::boxgain, "Box Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&boxgain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Sharp Gain
-	piParam = new PluginParameter(controlID::sharpgain, "Sharp Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&sharpgain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Air Gain
-	piParam = new PluginParameter(controlID::airgain, "Air Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&airgain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Box Freq
-	piParam = new PluginParameter(controlID::boxfc, "Box Freq", "Hz", controlVariableType::kDouble, 300.000000, 650.000000, 450.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&boxfc, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Box Q
-	piParam = new PluginParameter(controlID::boxq, "Box Q", "", controlVariableType::kDouble, 0.000000, 12.000000, 6.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&boxq, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Input Gain
-	piParam = new PluginParameter(controlID::inlvl, "Input Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&inlvl, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Output Gain
-	piParam = new PluginParameter(controlID::outlvl, "Output Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&outlvl, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Sharp Freq
-	piParam = new PluginParameter(controlID::sharpfc, "Sharp Freq", "Hz", controlVariableType::kDouble, 1000.000000, 4000.000000, 2500.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&sharpfc, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Sharp Q
-	piParam = new PluginParameter(controlID::sharpq, "Sharp Q", "", controlVariableType::kDouble, 0.000000, 12.000000, 6.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&sharpq, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Air Freq
-	piParam = new PluginParameter(controlID::airfc, "Air Freq", "Hz", controlVariableType::kDouble, 10000.000000, 20000.000000, 15000.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&airfc, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Gate Threshold
-	piParam = new PluginParameter(controlID::gatethresh, "Gate Threshold", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&gatethresh, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Gate Attack
-	piParam = new PluginParameter(controlID::gateattack, "Gate Attack", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&gateattack, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Gate Release
-	piParam = new PluginParameter(controlID::gaterelease, "Gate Release", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&gaterelease, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Gate Out Gain
-	piParam = new PluginParameter(controlID::gategain, "Gate Out Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&gategain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Comp Threshold
-	piParam = new PluginParameter(controlID::compthresh, "Comp Threshold", "dB", controlVariableType::kDouble, -36.000000, 0.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&compthresh, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Comp Ratio
-	piParam = new PluginParameter(controlID::compratio, "Comp Ratio", "%", controlVariableType::kDouble, 1.000000, 100.000000, 50.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&compratio, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Comp Attack
-	piParam = new PluginParameter(controlID::compattack, "Comp Attack", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&compattack, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Comp Release
-	piParam = new PluginParameter(controlID::comprelease, "Comp Release", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&comprelease, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Comp Out Gain
-	piParam = new PluginParameter(controlID::compgain, "Comp Out Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&compgain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Verb Wet
-	piParam = new PluginParameter(controlID::verbgain, "Verb Wet", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&verbgain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Delay Feedback
-	piParam = new PluginParameter(controlID::delayfb, "Delay Feedback", "%", controlVariableType::kDouble, 0.000000, 100.000000, 20.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&delayfb, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Delay Time
-	piParam = new PluginParameter(controlID::delaytime, "Delay Time", "mSec", controlVariableType::kDouble, 0.000000, 500.000000, 50.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&delaytime, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Verb Dry
-	piParam = new PluginParameter(controlID::drygain, "Verb Dry", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&drygain, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Verb Time
-	piParam = new PluginParameter(controlID::verbtime, "Verb Time", "mSec", controlVariableType::kDouble, 0.000000, 5000.000000, 10.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&verbtime, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Predelay
-	piParam = new PluginParameter(controlID::preverbtime, "Predelay", "mSec", controlVariableType::kDouble, 0.000000, 500.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&preverbtime, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Reverb Time
-	piParam = new PluginParameter(controlID::verbtime2, "Reverb Time", "", controlVariableType::kDouble, 0.000000, 1.000000, 0.500000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&verbtime2, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Delay Dry
-	piParam = new PluginParameter(controlID::delaydry, "Delay Dry", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&delaydry, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Delay Wet
-	piParam = new PluginParameter(controlID::delaywet, "Delay Wet", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&delaywet, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- discrete control: VOCAL MUTE
-	piParam = new PluginParameter(controlID::eqmute, "VOCAL MUTE", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
-	piParam->setBoundVariable(&eqmute, boundVariableType::kInt);
-	piParam->setIsDiscreteSwitch(true);
-	addPluginParameter(piParam);
-
-	// --- discrete control: BPM Delay
-	piParam = new PluginParameter(controlID::bpmdelay, "BPM Delay", "Quarter,Dotted4,Eighth,Dotted8", "Quarter");
-	piParam->setBoundVariable(&bpmdelay, boundVariableType::kInt);
-	piParam->setIsDiscreteSwitch(true);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Input
-	piParam = new PluginParameter(controlID::prein, "Input", "dB", controlVariableType::kDouble, -60.000000, 12.000000, -3.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&prein, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Saturation
-	piParam = new PluginParameter(controlID::presat, "Saturation", "", controlVariableType::kDouble, 1.000000, 3.000000, 1.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&presat, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Assymetry
-	piParam = new PluginParameter(controlID::preass, "Assymetry", "", controlVariableType::kDouble, 0.000000, 10.000000, 0.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&preass, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- continuous control: Output
-	piParam = new PluginParameter(controlID::preout, "Output", "dB", controlVariableType::kDouble, -30.000000, 6.000000, -3.000000, taper::kLinearTaper);
-	piParam->setParameterSmoothing(false);
-	piParam->setSmoothingTimeMsec(100.00);
-	piParam->setBoundVariable(&preout, boundVariableType::kDouble);
-	addPluginParameter(piParam);
-
-	// --- discrete control: PRE MUTE
-	piParam = new PluginParameter(controlID::preampmute, "PRE MUTE", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
-	piParam->setBoundVariable(&preampmute, boundVariableType::kInt);
-	piParam->setIsDiscreteSwitch(true);
-	addPluginParameter(piParam);
-
-	// --- Aux Attributes
-	AuxParameterAttribute auxAttribute;
-
-	// --- RAFX GUI attributes
-	// --- controlID::boxgain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::boxgain, auxAttribute);
-
-	// --- controlID::sharpgain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::sharpgain, auxAttribute);
-
-	// --- controlID::airgain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::airgain, auxAttribute);
-
-	// --- controlID::boxfc
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::boxfc, auxAttribute);
-
-	// --- controlID::boxq
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::boxq, auxAttribute);
-
-	// --- controlID::inlvl
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::inlvl, auxAttribute);
-
-	// --- controlID::outlvl
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::outlvl, auxAttribute);
-
-	// --- controlID::sharpfc
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::sharpfc, auxAttribute);
-
-	// --- controlID::sharpq
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::sharpq, auxAttribute);
-
-	// --- controlID::airfc
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::airfc, auxAttribute);
-
-	// --- controlID::gatethresh
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::gatethresh, auxAttribute);
-
-	// --- controlID::gateattack
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::gateattack, auxAttribute);
-
-	// --- controlID::gaterelease
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::gaterelease, auxAttribute);
-
-	// --- controlID::gategain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::gategain, auxAttribute);
-
-	// --- controlID::compthresh
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::compthresh, auxAttribute);
-
-	// --- controlID::compratio
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::compratio, auxAttribute);
-
-	// --- controlID::compattack
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::compattack, auxAttribute);
-
-	// --- controlID::comprelease
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::comprelease, auxAttribute);
-
-	// --- controlID::compgain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::compgain, auxAttribute);
-
-	// --- controlID::verbgain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::verbgain, auxAttribute);
-
-	// --- controlID::delayfb
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::delayfb, auxAttribute);
-
-	// --- controlID::delaytime
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::delaytime, auxAttribute);
-
-	// --- controlID::drygain
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::drygain, auxAttribute);
-
-	// --- controlID::verbtime
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::verbtime, auxAttribute);
-
-	// --- controlID::preverbtime
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::preverbtime, auxAttribute);
-
-	// --- controlID::verbtime2
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::verbtime2, auxAttribute);
-
-	// --- controlID::delaydry
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::delaydry, auxAttribute);
-
-	// --- controlID::delaywet
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::delaywet, auxAttribute);
-
-	// --- controlID::eqmute
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(1073741825);
-	setParamAuxAttribute(controlID::eqmute, auxAttribute);
-
-	// --- controlID::bpmdelay
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(268435456);
-	setParamAuxAttribute(controlID::bpmdelay, auxAttribute);
-
-	// --- controlID::prein
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::prein, auxAttribute);
-
-	// --- controlID::presat
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::presat, auxAttribute);
-
-	// --- controlID::preass
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::preass, auxAttribute);
-
-	// --- controlID::preout
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(2147483648);
-	setParamAuxAttribute(controlID::preout, auxAttribute);
-
-	// --- controlID::preampmute
-	auxAttribute.reset(auxGUIIdentifier::guiControlData);
-	auxAttribute.setUintAttribute(1073741825);
-	setParamAuxAttribute(controlID::preampmute, auxAttribute);
-
-
-	// **--0xEDA5--**
-   
-    // --- BONUS Parameter
-    // --- SCALE_GUI_SIZE
-    PluginParameter* piParamBonus = new PluginParameter(SCALE_GUI_SIZE, "Scale GUI", "tiny,small,medium,normal,large,giant", "normal");
-    addPluginParameter(piParamBonus);
-
-	// --- create the super fast access array
-	initPluginParameterArray();
-
-    return true;
-}
-
-/**
-\brief initialize object for a new run of audio; called just before audio streams
-
-Operation:
-- store sample rate and bit depth on audioProcDescriptor - this information is globally available to all core functions
-- reset your member objects here
-
-\param resetInfo structure of information about current audio format
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::reset(ResetInfo& resetInfo)
-{
-    // --- save for audio processing
-    audioProcDescriptor.sampleRate = resetInfo.sampleRate;
-    audioProcDescriptor.bitDepth = resetInfo.bitDepth;
-
-	 
-
-	ClassATubePreParameters preparams = preamp.getParameters();
-	preparams.highShelf_fc = 15000;
-	preparams.highShelfBoostCut_dB = 2.5;
-	preamp.setParameters(preparams);
-
-	AudioFilterParameters hpassparams = HPass.getParameters();		// High Pass Filter at 200 Hz
-	hpassparams.algorithm = filterAlgorithm::kHPF1;
-	hpassparams.fc = 200;
-	HPass.setParameters(hpassparams);
-	HPass.reset(resetInfo.sampleRate);
-
-	AudioFilterParameters notch1params = Notch1.getParameters();	// Parametric EQ 1
-	notch1params.algorithm = filterAlgorithm::kCQParaEQ;
-	Notch1.setParameters(notch1params);
-	Notch1.reset(resetInfo.sampleRate);
-
-	AudioFilterParameters notch2params = Notch2.getParameters();	// Parametric EQ 2
-	notch2params.algorithm = filterAlgorithm::kCQParaEQ;
-	Notch2.setParameters(notch2params);
-	Notch2.reset(resetInfo.sampleRate);
-
-	AudioFilterParameters hshelfparams = HShelf.getParameters();	// High Shelf Filter
-	hshelfparams.algorithm = filterAlgorithm::kHiShelf;
-	HShelf.setParameters(hshelfparams);
-	HShelf.reset(resetInfo.sampleRate);
-
-	DynamicsProcessorParameters gateparams = Gate.getParameters();	// Gate (Downward Expander)
-	gateparams.calculation = dynamicsProcessorType::kDownwardExpander;
-	gateparams.hardLimitGate = true;								// makes the ratio to infinity
-	Gate.setParameters(gateparams);
-	Gate.reset(resetInfo.sampleRate);
-
-	DynamicsProcessorParameters compparams = Comp.getParameters();	// Compressor
-	compparams.calculation = dynamicsProcessorType::kCompressor;
-	Comp.setParameters(compparams);
-	Comp.reset(resetInfo.sampleRate);
-
-	ReverbTankParameters verbparams = Verb.getParameters();			// Reverb
-	verbparams.density = reverbDensity::kThick;						// Thick Density
-	Verb.setParameters(verbparams);
-	Verb.reset(resetInfo.sampleRate);
-
-	AudioDelayParameters delayparams = Delay.getParameters();		// Delay
-	delayparams.algorithm = delayAlgorithm::kPingPong;
-	delayparams.updateType = delayUpdateType::kLeftAndRight;
-	Delay.setParameters(delayparams);
-	Delay.reset(resetInfo.sampleRate);
-
-	Delay.createDelayBuffers(resetInfo.sampleRate, 2000.0);
-
-    // --- other reset inits
-    return PluginBase::reset(resetInfo);
-}
-
-/**
-\brief one-time initialize function called after object creation and before the first reset( ) call
-
-Operation:
-- saves structure for the plugin to use; you can also load WAV files or state information here
-*/
-bool PluginCore::initialize(PluginInfo& pluginInfo)
-{
-	// --- add one-time init stuff here
-
-	return true;
-}
-
-/**
-\brief do anything needed prior to arrival of audio buffers
-
-Operation:
-- syncInBoundVariables when preProcessAudioBuffers is called, it is *guaranteed* that all GUI control change information
-  has been applied to plugin parameters; this binds parameter changes to your underlying variables
-- NOTE: postUpdatePluginParameter( ) will be called for all bound variables that are acutally updated; if you need to process
-  them individually, do so in that function
-- use this function to bulk-transfer the bound variable data into your plugin's member object variables
-
-\param processInfo structure of information about *buffer* processing
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
-{
-    // --- sync internal variables to GUI parameters; you can also do this manually if you don't
-    //     want to use the auto-variable-binding
-    syncInBoundVariables();
-
-    return true;
-}
-
-/**
-\brief frame-processing method
-
-Operation:
-- decode the plugin type - for synth plugins, fill in the rendering code; for FX plugins, delete the if(synth) portion and add your processing code
-- note that MIDI events are fired for each sample interval so that MIDI is tightly sunk with audio
-- doSampleAccurateParameterUpdates will perform per-sample interval smoothing
-
-\param processFrameInfo structure of information about *frame* processing
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
-{
-	// --- fire any MIDI events for this sample interval
-	processFrameInfo.midiEventQueue->fireMidiEvents(processFrameInfo.currentFrame);
-
-	// --- do per-frame updates; VST automation and parameter smoothing
- 	doSampleAccurateParameterUpdates();
- 	double BPM = processFrameInfo.hostInfo->dBPM;
-	UpdateParameters(BPM);
-
-	double xnL = processFrameInfo.audioInputFrame[0];
-	double xnR = processFrameInfo.audioInputFrame[1];
-
-	double firstgainL = xnL * gain_cooked_in;
-	double firstgainR = xnR * gain_cooked_in;
-
-	double preampL, preampR;
-
-
-	if (preampmute == 0)
-	{
-		preampL = preamp.processAudioSample(firstgainL);
-		preampR = preamp.processAudioSample(firstgainR);
-	}
-	if (preampmute == 1)
-	{
-		preampL = firstgainL;
-		preampR = firstgainR;
-	}
-
-
-	double gatedsigL = Gate.processAudioSample(preampL);
-	double gatedsigR = Gate.processAudioSample(preampR);
-
-	double compedsigL = Comp.processAudioSample(gatedsigL);
-	double compedsigR = Comp.processAudioSample(gatedsigR);
-
-	double highpassedsigL = HPass.processAudioSample(compedsigL);
-	double highpassedsigR = HPass.processAudioSample(compedsigR);
-
-	double notch1sigL = Notch1.processAudioSample(highpassedsigL);
-	double notch1sigR = Notch1.processAudioSample(highpassedsigR);
-
-	double notch2sigL = Notch2.processAudioSample(notch1sigL);
-	double notch2sigR = Notch2.processAudioSample(notch1sigR);
-
-	double hshelfsigL = HShelf.processAudioSample(notch2sigL);
-	double hshelfsigR = HShelf.processAudioSample(notch2sigR);
-
-	float inputFrame[2];
-
-	if (eqmute == 0)		// if EQ MUTE is OFF
-	{
-		inputFrame[0] = hshelfsigL;
-		inputFrame[1] = hshelfsigR;
-	}
-	if (eqmute == 1)		// if EQ MUTE is ON
-	{
-		inputFrame[0] = compedsigL;
-		inputFrame[1] = compedsigR;
-	}
-
-
-	float ReverbFrame[2];
-	float DelayFrame[2];
-
-	Verb.processAudioFrame(inputFrame, ReverbFrame , processFrameInfo.numAudioInChannels, processFrameInfo.numAudioOutChannels);
-	Delay.processAudioFrame(inputFrame, DelayFrame, processFrameInfo.numAudioInChannels, processFrameInfo.numAudioOutChannels);
-	//Verb.processAudioFrame(processFrameInfo.audioInputFrame, processFrameInfo.audioOutputFrame, processFrameInfo.numAudioInChannels, processFrameInfo.numAudioOutChannels);
-	double verbsigL = Verb.processAudioSample(hshelfsigL);
-	double delaysigL = Delay.processAudioSample(hshelfsigL);
-
-	double sumL = ((.6 * inputFrame[0]) + (.6 * DelayFrame[0]) + (.6 * ReverbFrame[0])) * gain_cooked_out;
-	double sumR = ((.6 * inputFrame[1]) + (.6 * DelayFrame[1]) + (.6 * ReverbFrame[1])) * gain_cooked_out;
-
-	//double delaysigL = Delay.processAudioSample(hshelfsigL);
-	//double delaysigR = Delay.processAudioSample(hshelfsigR);
-
-
-	double ynL = sumL;
-	double ynR = sumR;
-
-    // --- FX Plugin:
-    if(processFrameInfo.channelIOConfig.inputChannelFormat == kCFMono &&
-       processFrameInfo.channelIOConfig.outputChannelFormat == kCFMono)
-    {
-		// --- pass through code: change this with your signal processing
-		processFrameInfo.audioOutputFrame[0] = ynL; //processFrameInfo.audioInputFrame[0];
-
-        return true; /// processed
-    }
-
-    // --- Mono-In/Stereo-Out
-    else if(processFrameInfo.channelIOConfig.inputChannelFormat == kCFMono &&
-       processFrameInfo.channelIOConfig.outputChannelFormat == kCFStereo)
-    {
-		// --- pass through code: change this with your signal processing
-		processFrameInfo.audioOutputFrame[0] = ynL; //processFrameInfo.audioInputFrame[0];
-		processFrameInfo.audioOutputFrame[1] = ynR; //processFrameInfo.audioInputFrame[0];
-
-        return true; /// processed
-    }
-
-    // --- Stereo-In/Stereo-Out
-    else if(processFrameInfo.channelIOConfig.inputChannelFormat == kCFStereo &&
-       processFrameInfo.channelIOConfig.outputChannelFormat == kCFStereo)
-    {
-		// --- pass through code: change this with your signal processing
-		processFrameInfo.audioOutputFrame[0] = ynL; // processFrameInfo.audioInputFrame[0];
-		processFrameInfo.audioOutputFrame[1] = ynR; // processFrameInfo.audioInputFrame[1];
-
-        return true; /// processed
-    }
-
-    return false; /// NOT processed
-}
-
-void PluginCore::UpdateParameters(double BPM)
-{
-	gain_cooked_in = pow(10.0, inlvl / 20.0);
-	gain_cooked_out = pow(10.0, outlvl / 20.0);
-
-	ClassATubePreParameters preparams = preamp.getParameters();
-	preparams.inputLevel_dB = prein;
-	preparams.saturation = presat;
-	preparams.asymmetry = preass;
-	preparams.outputLevel_dB = preout;
-	preamp.setParameters(preparams);
-
-	AudioFilterParameters hpassparams = HPass.getParameters();			// High Pass EQ
-	HPass.setParameters(hpassparams);
-
-	AudioFilterParameters notch1params = Notch1.getParameters();		// Parametric EQ 1
-	notch1params.boostCut_dB = boxgain;
-	notch1params.fc = boxfc;
-	notch1params.Q = boxq;
-	Notch1.setParameters(notch1params);
-
-	AudioFilterParameters notch2params = Notch2.getParameters();		// Parametric EQ 2
-	notch2params.boostCut_dB = sharpgain;
-	notch2params.fc = sharpfc;
-	notch2params.Q = sharpq;
-	Notch2.setParameters(notch2params);
-
-	AudioFilterParameters hshelfparams = HShelf.getParameters();		// High Shelf EQ
-	hshelfparams.boostCut_dB = airgain;
-	hshelfparams.fc = airfc;
-	HShelf.setParameters(hshelfparams);
-
-	DynamicsProcessorParameters gateparams = Gate.getParameters();		// Gate
-	gateparams.threshold_dB = gatethresh;
-	// gateparams.gainReduction = gategainreduction;
-	gateparams.attackTime_mSec = gateattack;
-	gateparams.releaseTime_mSec = gaterelease;
-	gateparams.outputGain_dB = gategain;
-	Gate.setParameters(gateparams);
-
-	DynamicsProcessorParameters compparams = Comp.getParameters();		// Compressor
-	compparams.threshold_dB = compthresh;
-	compparams.ratio = compratio;
-	compparams.attackTime_mSec = compattack;
-	compparams.releaseTime_mSec = comprelease;
-	compparams.outputGain_dB = compgain;
-	Comp.setParameters(compparams);
-
-	ReverbTankParameters verbparams = Verb.getParameters();				// Reverb
-	verbparams.fixeDelayMax_mSec = verbtime;
-	verbparams.preDelayTime_mSec = preverbtime;
-	verbparams.dryLevel_dB = drygain;
-	verbparams.wetLevel_dB = verbgain;
-	verbparams.kRT = verbtime2;
-	Verb.setParameters(verbparams);
-
-
-	//double BPM = infoBPM.dBPM;
-	double Tquarter = BPM * 60000; 
-	double Tqtrip = (Tquarter * 1.5);
-	double Teighth = Tquarter / 2; 
-	double Tetrip = (Teighth * 1.5);
-
-	AudioDelayParameters delayparams = Delay.getParameters();			// Delay
-	delayparams.feedback_Pct = delayfb;
-
-	
-	if (bpmdelay == 0)
-	{
-		delayparams.leftDelay_mSec = Tquarter;
-		delayparams.rightDelay_mSec = Tquarter;
-	}
-	if (bpmdelay == 1)
-	{
-		delayparams.leftDelay_mSec = Tqtrip;
-		delayparams.rightDelay_mSec = Tqtrip;
-	}
-	if (bpmdelay == 2)
-	{
-		delayparams.leftDelay_mSec = Teighth;
-		delayparams.rightDelay_mSec = Teighth;
-	}
-	if (bpmdelay == 3)
-	{
-		delayparams.leftDelay_mSec = Tetrip;
-		delayparams.rightDelay_mSec = Tetrip;
-	}
-	
-	
-	//delayparams.leftDelay_mSec = delaytime;
-	//delayparams.rightDelay_mSec = delaytime;
-
-	delayparams.dryLevel_dB = delaydry;
-	delayparams.wetLevel_dB = delaywet;
-	Delay.setParameters(delayparams);
-
-}
-
-/**
-\brief do anything needed prior to arrival of audio buffers
-
-Operation:
-- updateOutBoundVariables sends metering data to the GUI meters
-
-\param processInfo structure of information about *buffer* processing
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
-{
-	// --- update outbound variables; currently this is meter data only, but could be extended
-	//     in the future
-	updateOutBoundVariables();
-
-    return true;
-}
-
-/**
-\brief update the PluginParameter's value based on GUI control, preset, or data smoothing (thread-safe)
-
-Operation:
-- update the parameter's value (with smoothing this initiates another smoothing process)
-- call postUpdatePluginParameter to do any further processing
-
-\param controlID the control ID value of the parameter being updated
-\param controlValue the new control value
-\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo)
-{
-    // --- use base class helper
-    setPIParamValue(controlID, controlValue);
-
-    // --- do any post-processing
-    postUpdatePluginParameter(controlID, controlValue, paramInfo);
-
-    return true; /// handled
-}
-
-/**
-\brief update the PluginParameter's value based on *normlaized* GUI control, preset, or data smoothing (thread-safe)
-
-Operation:
-- update the parameter's value (with smoothing this initiates another smoothing process)
-- call postUpdatePluginParameter to do any further processing
-
-\param controlID the control ID value of the parameter being updated
-\param normalizedValue the new control value in normalized form
-\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo)
-{
-	// --- use base class helper, returns actual value
-	double controlValue = setPIParamValueNormalized(controlID, normalizedValue, paramInfo.applyTaper);
-
-	// --- do any post-processing
-	postUpdatePluginParameter(controlID, controlValue, paramInfo);
-
-	return true; /// handled
-}
-
-/**
-\brief perform any operations after the plugin parameter has been updated; this is one paradigm for
-	   transferring control information into vital plugin variables or member objects. If you use this
-	   method you can decode the control ID and then do any cooking that is needed. NOTE: do not
-	   overwrite bound variables here - this is ONLY for any extra cooking that is required to convert
-	   the GUI data to meaninful coefficients or other specific modifiers.
-
-\param controlID the control ID value of the parameter being updated
-\param controlValue the new control value
-\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo)
-{
-    // --- now do any post update cooking; be careful with VST Sample Accurate automation
-    //     If enabled, then make sure the cooking functions are short and efficient otherwise disable it
-    //     for the Parameter involved
-    /*switch(controlID)
-    {
-        case 0:
-        {
-            return true;    /// handled
-        }
-
-        default:
-            return false;   /// not handled
-    }*/
-
-    return false;
-}
-
-/**
-\brief has nothing to do with actual variable or updated variable (binding)
-
-CAUTION:
-- DO NOT update underlying variables here - this is only for sending GUI updates or letting you
-  know that a parameter was changed; it should not change the state of your plugin.
-
-WARNING:
-- THIS IS NOT THE PREFERRED WAY TO LINK OR COMBINE CONTROLS TOGETHER. THE PROPER METHOD IS
-  TO USE A CUSTOM SUB-CONTROLLER THAT IS PART OF THE GUI OBJECT AND CODE.
-  SEE http://www.willpirkle.com for more information
-
-\param controlID the control ID value of the parameter being updated
-\param actualValue the new control value
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::guiParameterChanged(int32_t controlID, double actualValue)
-{
-	/*
-	switch (controlID)
-	{
-		case controlID::<your control here>
-		{
-
-			return true; // handled
-		}
-
-		default:
-			break;
-	}*/
-
-	return false; /// not handled
-}
-
-/**
-\brief For Custom View and Custom Sub-Controller Operations
-
-NOTES:
-- this is for advanced users only to implement custom view and custom sub-controllers
-- see the SDK for examples of use
-
-\param messageInfo a structure containing information about the incoming message
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::processMessage(MessageInfo& messageInfo)
-{
-	// --- decode message
-	switch (messageInfo.message)
-	{
-		// --- add customization appearance here
-	case PLUGINGUI_DIDOPEN:
-	{
-		return false;
-	}
-
-	// --- NULL pointers so that we don't accidentally use them
-	case PLUGINGUI_WILLCLOSE:
-	{
-		return false;
-	}
-
-	// --- update view; this will only be called if the GUI is actually open
-	case PLUGINGUI_TIMERPING:
-	{
-		return false;
-	}
-
-	// --- register the custom view, grab the ICustomView interface
-	case PLUGINGUI_REGISTER_CUSTOMVIEW:
-	{
-
-		return false;
-	}
-
-	case PLUGINGUI_REGISTER_SUBCONTROLLER:
-	case PLUGINGUI_QUERY_HASUSERCUSTOM:
-	case PLUGINGUI_USER_CUSTOMOPEN:
-	case PLUGINGUI_USER_CUSTOMCLOSE:
-	case PLUGINGUI_EXTERNAL_SET_NORMVALUE:
-	case PLUGINGUI_EXTERNAL_SET_ACTUALVALUE:
-	{
-
-		return false;
-	}
-
-	default:
-		break;
-	}
-
-	return false; /// not handled
-}
-
-
-/**
-\brief process a MIDI event
-
-NOTES:
-- MIDI events are 100% sample accurate; this function will be called repeatedly for every MIDI message
-- see the SDK for examples of use
-
-\param event a structure containing the MIDI event data
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::processMIDIEvent(midiEvent& event)
-{
-	return true;
-}
-
-/**
-\brief (for future use)
-
-NOTES:
-- MIDI events are 100% sample accurate; this function will be called repeatedly for every MIDI message
-- see the SDK for examples of use
-
-\param vectorJoysickData a structure containing joystick data
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData)
-{
-	return true;
-}
-
-/**
-\brief use this method to add new presets to the list
-
-NOTES:
-- see the SDK for examples of use
-- for non RackAFX users that have large paramter counts, there is a secret GUI control you
-  can enable to write C++ code into text files, one per preset. See the SDK or http://www.willpirkle.com for details
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::initPluginPresets()
-{
-	// **--0xFF7A--**
-
-	// --- Plugin Presets 
-	int index = 0;
-	PresetInfo* preset = nullptr;
-
-	// --- Preset: Factory Preset
-	preset = new PresetInfo(index++, "Factory Preset");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::boxgain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::sharpgain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::airgain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::boxfc, 450.000000);
-	setPresetParameter(preset->presetParameters, controlID::boxq, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::inlvl, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::outlvl, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::sharpfc, 2500.000000);
-	setPresetParameter(preset->presetParameters, controlID::sharpq, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::airfc, 15000.000000);
-	setPresetParameter(preset->presetParameters, controlID::gatethresh, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::gateattack, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::gaterelease, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::gategain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::compthresh, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::compratio, 50.000000);
-	setPresetParameter(preset->presetParameters, controlID::compattack, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::comprelease, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::compgain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::verbgain, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::delayfb, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::delaytime, 50.000000);
-	setPresetParameter(preset->presetParameters, controlID::drygain, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::verbtime, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::preverbtime, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::verbtime2, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::delaydry, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::delaywet, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::eqmute, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::bpmdelay, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::prein, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::presat, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::preass, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::preout, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::preampmute, -0.000000);
-	addPreset(preset);
-
-	// --- Preset: Pats Main Vocal
-	preset = new PresetInfo(index++, "Pats Main Vocal");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::boxgain, 2.879999);
-	setPresetParameter(preset->presetParameters, controlID::sharpgain, 3.120000);
-	setPresetParameter(preset->presetParameters, controlID::airgain, 3.480000);
-	setPresetParameter(preset->presetParameters, controlID::boxfc, 549.750000);
-	setPresetParameter(preset->presetParameters, controlID::boxq, 5.820000);
-	setPresetParameter(preset->presetParameters, controlID::inlvl, 5.639999);
-	setPresetParameter(preset->presetParameters, controlID::outlvl, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::sharpfc, 2005.000000);
-	setPresetParameter(preset->presetParameters, controlID::sharpq, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::airfc, 13850.000000);
-	setPresetParameter(preset->presetParameters, controlID::gatethresh, -46.800003);
-	setPresetParameter(preset->presetParameters, controlID::gateattack, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::gaterelease, 671.000000);
-	setPresetParameter(preset->presetParameters, controlID::gategain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::compthresh, -23.040001);
-	setPresetParameter(preset->presetParameters, controlID::compratio, 56.435001);
-	setPresetParameter(preset->presetParameters, controlID::compattack, 617.500000);
-	setPresetParameter(preset->presetParameters, controlID::comprelease, 486.999939);
-	setPresetParameter(preset->presetParameters, controlID::compgain, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::verbgain, -36.300003);
-	setPresetParameter(preset->presetParameters, controlID::delayfb, 40.000000);
-	setPresetParameter(preset->presetParameters, controlID::delaytime, 185.000000);
-	setPresetParameter(preset->presetParameters, controlID::drygain, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::verbtime, 2260.000000);
-	setPresetParameter(preset->presetParameters, controlID::preverbtime, 122.499985);
-	setPresetParameter(preset->presetParameters, controlID::verbtime2, 0.735000);
-	setPresetParameter(preset->presetParameters, controlID::delaydry, -60.000000);
-	setPresetParameter(preset->presetParameters, controlID::delaywet, -24.600002);
-	setPresetParameter(preset->presetParameters, controlID::eqmute, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::bpmdelay, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::prein, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::presat, 1.190000);
-	setPresetParameter(preset->presetParameters, controlID::preass, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::preout, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::preampmute, -0.000000);
-	addPreset(preset);
-
-
-	// **--0xA7FF--**
-
-    return true;
-}
-
-/**
-\brief setup the plugin description strings, flags and codes; this is ordinarily done through the ASPiKreator or CMake
-
-\return true if operation succeeds, false otherwise
-*/
-bool PluginCore::initPluginDescriptors()
-{
-    pluginDescriptor.pluginName = PluginCore::getPluginName();
-    pluginDescriptor.shortPluginName = PluginCore::getShortPluginName();
-    pluginDescriptor.vendorName = PluginCore::getVendorName();
-    pluginDescriptor.pluginTypeCode = PluginCore::getPluginType();
-
-	// --- describe the plugin attributes; set according to your needs
-	pluginDescriptor.hasSidechain = kWantSidechain;
-	pluginDescriptor.latencyInSamples = kLatencyInSamples;
-	pluginDescriptor.tailTimeInMSec = kTailTimeMsec;
-	pluginDescriptor.infiniteTailVST3 = kVSTInfiniteTail;
-
-    // --- AAX
-    apiSpecificInfo.aaxManufacturerID = kManufacturerID;
-    apiSpecificInfo.aaxProductID = kAAXProductID;
-    apiSpecificInfo.aaxBundleID = kAAXBundleID;  /* MacOS only: this MUST match the bundle identifier in your info.plist file */
-    apiSpecificInfo.aaxEffectID = "aaxDeveloper.";
-    apiSpecificInfo.aaxEffectID.append(PluginCore::getPluginName());
-    apiSpecificInfo.aaxPluginCategoryCode = kAAXCategory;
-
-    // --- AU
-    apiSpecificInfo.auBundleID = kAUBundleID;
-	apiSpecificInfo.auBundleName = kAUBundleName;   /* MacOS only: this MUST match the bundle identifier in your info.plist file */
-    apiSpecificInfo.auBundleName = kAUBundleName;
-
-    // --- VST3
-    apiSpecificInfo.vst3FUID = PluginCore::getVSTFUID(); // OLE string format
-    apiSpecificInfo.vst3BundleID = kVST3BundleID;/* MacOS only: this MUST match the bundle identifier in your info.plist file */
-	apiSpecificInfo.enableVST3SampleAccurateAutomation = kVSTSAA;
-	apiSpecificInfo.vst3SampleAccurateGranularity = kVST3SAAGranularity;
-
-    // --- AU and AAX
-    apiSpecificInfo.fourCharCode = PluginCore::getFourCharCode();
-
-    return true;
-}
-
-// --- static functions required for VST3/AU only --------------------------------------------- //
-const char* PluginCore::getPluginBundleName() { return kAUBundleName; }
-const char* PluginCore::getPluginName(){ return kPluginName; }
-const char* PluginCore::getShortPluginName(){ return kShortPluginName; }
-const char* PluginCore::getVendorName(){ return kVendorName; }
-const char* PluginCore::getVendorURL(){ return kVendorURL; }
-const char* PluginCore::getVendorEmail(){ return kVendorEmail; }
-const char* PluginCore::getAUCocoaViewFactoryName(){ return AU_COCOA_VIEWFACTORY_STRING; }
-pluginType PluginCore::getPluginType(){ return kPluginType; }
-const char* PluginCore::getVSTFUID(){ return kVSTFUID; }
-int32_t PluginCore::getFourCharCode(){ return kFourCharCode; }
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  plugincore.cpp
+//
+/**
+    \file   plugincore.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  Implementation file for PluginCore object
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "plugincore.h"
+#include "plugindescription.h"
+
+/**
+\brief PluginCore constructor is launching pad for object initialization
+
+Operations:
+- initialize the plugin description (strings, codes, numbers, see initPluginDescriptors())
+- setup the plugin's audio I/O channel support
+- create the PluginParameter objects that represent the plugin parameters (see FX book if needed)
+- create the presets
+*/
+PluginCore::PluginCore()
+{
+    // --- describe the plugin; call the helper to init the static parts you setup in plugindescription.h
+    initPluginDescriptors();
+
+    // --- default I/O combinations
+	// --- for FX plugins
+	if (getPluginType() == kFXPlugin)
+	{
+		addSupportedIOCombination({ kCFMono, kCFMono });
+		addSupportedIOCombination({ kCFMono, kCFStereo });
+		addSupportedIOCombination({ kCFStereo, kCFStereo });
+	}
+	else // --- synth plugins have no input, only output
+	{
+		addSupportedIOCombination({ kCFNone, kCFMono });
+		addSupportedIOCombination({ kCFNone, kCFStereo });
+	}
+
+	// --- for sidechaining, we support mono and stereo inputs; auxOutputs reserved for future use
+	addSupportedAuxIOCombination({ kCFMono, kCFNone });
+	addSupportedAuxIOCombination({ kCFStereo, kCFNone });
+
+	// --- create the parameters
+    initPluginParameters();
+
+    // --- create the presets
+    initPluginPresets();
+}
+
+/**
+\brief create all of your plugin parameters here
+
+\return true if parameters were created, false if they already existed
+*/
+bool PluginCore::initPluginParameters()
+{
+	if (pluginParameterMap.size() > 0)
+		return false;
+
+    // --- Add your plugin parameter instantiation code bewtween these hex codes
+	// **--0xDEA7--**
+
+
+	// --- Declaration of Plugin Parameter Objects 
+	PluginParameter* piParam = nullptr;
+
+	// --- continuous control: Box Gain
+	piParam = new PluginParameter(controlID::boxgain, "Box Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&boxgain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Sharp Gain
+	piParam = new PluginParameter(controlID::sharpgain, "Sharp Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&sharpgain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Air Gain
+	piParam = new PluginParameter(controlID::airgain, "Air Gain", "", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&airgain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Box Freq
+	piParam = new PluginParameter(controlID::boxfc, "Box Freq", "Hz", controlVariableType::kDouble, 300.000000, 650.000000, 450.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&boxfc, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Box Q
+	piParam = new PluginParameter(controlID::boxq, "Box Q", "", controlVariableType::kDouble, 0.000000, 12.000000, 6.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&boxq, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Input Gain
+	piParam = new PluginParameter(controlID::inlvl, "Input Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&inlvl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Output Gain
+	piParam = new PluginParameter(controlID::outlvl, "Output Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&outlvl, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Sharp Freq
+	piParam = new PluginParameter(controlID::sharpfc, "Sharp Freq", "Hz", controlVariableType::kDouble, 1000.000000, 4000.000000, 2500.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&sharpfc, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Sharp Q
+	piParam = new PluginParameter(controlID::sharpq, "Sharp Q", "", controlVariableType::kDouble, 0.000000, 12.000000, 6.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&sharpq, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Air Freq
+	piParam = new PluginParameter(controlID::airfc, "Air Freq", "Hz", controlVariableType::kDouble, 10000.000000, 20000.000000, 15000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&airfc, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Gate Threshold
+	piParam = new PluginParameter(controlID::gatethresh, "Gate Threshold", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&gatethresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Gate Attack
+	piParam = new PluginParameter(controlID::gateattack, "Gate Attack", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&gateattack, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Gate Release
+	piParam = new PluginParameter(controlID::gaterelease, "Gate Release", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&gaterelease, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Gate Out Gain
+	piParam = new PluginParameter(controlID::gategain, "Gate Out Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&gategain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Threshold
+	piParam = new PluginParameter(controlID::compthresh, "Comp Threshold", "dB", controlVariableType::kDouble, -36.000000, 0.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&compthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Ratio
+	piParam = new PluginParameter(controlID::compratio, "Comp Ratio", "%", controlVariableType::kDouble, 1.000000, 100.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&compratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Attack
+	piParam = new PluginParameter(controlID::compattack, "Comp Attack", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&compattack, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Release
+	piParam = new PluginParameter(controlID::comprelease, "Comp Release", "mSec", controlVariableType::kDouble, 300.000000, 1000.000000, 300.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&comprelease, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Out Gain
+	piParam = new PluginParameter(controlID::compgain, "Comp Out Gain", "dB", controlVariableType::kDouble, -12.000000, 12.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&compgain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Verb Wet
+	piParam = new PluginParameter(controlID::verbgain, "Verb Wet", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&verbgain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Delay Feedback
+	piParam = new PluginParameter(controlID::delayfb, "Delay Feedback", "%", controlVariableType::kDouble, 0.000000, 100.000000, 20.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&delayfb, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Delay Time
+	piParam = new PluginParameter(controlID::delaytime, "Delay Time", "mSec", controlVariableType::kDouble, 0.000000, 500.000000, 50.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&delaytime, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Verb Dry
+	piParam = new PluginParameter(controlID::drygain, "Verb Dry", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&drygain, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Verb Time
+	piParam = new PluginParameter(controlID::verbtime, "Verb Time", "mSec", controlVariableType::kDouble, 0.000000, 5000.000000, 10.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&verbtime, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Predelay
+	piParam = new PluginParameter(controlID::preverbtime, "Predelay", "mSec", controlVariableType::kDouble, 0.000000, 500.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&preverbtime, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Reverb Time
+	piParam = new PluginParameter(controlID::verbtime2, "Reverb Time", "", controlVariableType::kDouble, 0.000000, 1.000000, 0.500000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&verbtime2, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Delay Dry
+	piParam = new PluginParameter(controlID::delaydry, "Delay Dry", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&delaydry, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Delay Wet
+	piParam = new PluginParameter(controlID::delaywet, "Delay Wet", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -60.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&delaywet, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: VOCAL MUTE
+	piParam = new PluginParameter(controlID::eqmute, "VOCAL MUTE", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
+	piParam->setBoundVariable(&eqmute, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: BPM Delay
+	piParam = new PluginParameter(controlID::bpmdelay, "BPM Delay", "Quarter,Dotted4,Eighth,Dotted8", "Quarter");
+	piParam->setBoundVariable(&bpmdelay, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Input
+	piParam = new PluginParameter(controlID::prein, "Input", "dB", controlVariableType::kDouble, -60.000000, 12.000000, -3.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&prein, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Saturation
+	piParam = new PluginParameter(controlID::presat, "Saturation", "", controlVariableType::kDouble, 1.000000, 3.000000, 1.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&presat, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Assymetry
+	piParam = new PluginParameter(controlID::preass, "Assymetry", "", controlVariableType::kDouble, 0.000000, 10.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&preass, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Output
+	piParam = new PluginParameter(controlID::preout, "Output", "dB", controlVariableType::kDouble, -30.000000, 6.000000, -3.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&preout, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: PRE MUTE
+	piParam = new PluginParameter(controlID::preampmute, "PRE MUTE", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
+	piParam->setBoundVariable(&preampmute, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Dyn Link
+	piParam = new PluginParameter(controlID::dynlink, "Dyn Link", "Max,RMS Sum", "Max");
+	piParam->setBoundVariable(&dynlink, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Sidechain
+	piParam = new PluginParameter(controlID::sidechain, "Sidechain", "Internal,External", "Internal");
+	piParam->setBoundVariable(&sidechain, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Dyn Lookahead
+	piParam = new PluginParameter(controlID::lookahead, "Dyn Lookahead", "mSec", controlVariableType::kDouble, 0.000000, 10.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&lookahead, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Verb Engine
+	piParam = new PluginParameter(controlID::verbmode, "Verb Engine", "Tank,FDN,Convolution", "Tank");
+	piParam->setBoundVariable(&verbmode, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Preamp OS
+	piParam = new PluginParameter(controlID::oversampling, "Preamp OS", "Off,x2,x4", "Off");
+	piParam->setBoundVariable(&oversampling, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Chain Order
+	piParam = new PluginParameter(controlID::chainorder, "Chain Order", "Pre Dyn EQ,Pre EQ Dyn,Dyn Pre EQ,Dyn EQ Pre,EQ Pre Dyn,EQ Dyn Pre", "Pre Dyn EQ");
+	piParam->setBoundVariable(&chainorder, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Comp Mix
+	piParam = new PluginParameter(controlID::compmix, "Comp Mix", "%", controlVariableType::kDouble, 0.000000, 100.000000, 100.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&compmix, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Comp Mode
+	piParam = new PluginParameter(controlID::compmode, "Comp Mode", "Single,Multiband", "Single");
+	piParam->setBoundVariable(&compmode, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Crossover Lo
+	piParam = new PluginParameter(controlID::mbxoverlow, "MB Crossover Lo", "Hz", controlVariableType::kDouble, 40.000000, 1000.000000, 200.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbxoverlow, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Crossover Hi
+	piParam = new PluginParameter(controlID::mbxoverhigh, "MB Crossover Hi", "Hz", controlVariableType::kDouble, 1000.000000, 12000.000000, 3000.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbxoverhigh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Low Threshold
+	piParam = new PluginParameter(controlID::mblowthresh, "MB Low Threshold", "dB", controlVariableType::kDouble, -48.000000, 0.000000, -20.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mblowthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Low Ratio
+	piParam = new PluginParameter(controlID::mblowratio, "MB Low Ratio", "", controlVariableType::kDouble, 1.000000, 20.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mblowratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Low Attack
+	piParam = new PluginParameter(controlID::mblowattack, "MB Low Attack", "mSec", controlVariableType::kDouble, 0.100000, 100.000000, 20.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mblowattack, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Low Release
+	piParam = new PluginParameter(controlID::mblowrelease, "MB Low Release", "mSec", controlVariableType::kDouble, 10.000000, 1000.000000, 250.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mblowrelease, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Mid Threshold
+	piParam = new PluginParameter(controlID::mbmidthresh, "MB Mid Threshold", "dB", controlVariableType::kDouble, -48.000000, 0.000000, -20.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbmidthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Mid Ratio
+	piParam = new PluginParameter(controlID::mbmidratio, "MB Mid Ratio", "", controlVariableType::kDouble, 1.000000, 20.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbmidratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Mid Attack
+	piParam = new PluginParameter(controlID::mbmidattack, "MB Mid Attack", "mSec", controlVariableType::kDouble, 0.100000, 100.000000, 10.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbmidattack, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB Mid Release
+	piParam = new PluginParameter(controlID::mbmidrelease, "MB Mid Release", "mSec", controlVariableType::kDouble, 10.000000, 1000.000000, 150.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbmidrelease, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB High Threshold
+	piParam = new PluginParameter(controlID::mbhighthresh, "MB High Threshold", "dB", controlVariableType::kDouble, -48.000000, 0.000000, -20.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbhighthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB High Ratio
+	piParam = new PluginParameter(controlID::mbhighratio, "MB High Ratio", "", controlVariableType::kDouble, 1.000000, 20.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbhighratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB High Attack
+	piParam = new PluginParameter(controlID::mbhighattack, "MB High Attack", "mSec", controlVariableType::kDouble, 0.100000, 100.000000, 5.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbhighattack, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: MB High Release
+	piParam = new PluginParameter(controlID::mbhighrelease, "MB High Release", "mSec", controlVariableType::kDouble, 10.000000, 1000.000000, 100.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&mbhighrelease, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: EQ1 Mode
+	piParam = new PluginParameter(controlID::boxdyn, "EQ1 Mode", "Static,Dynamic", "Static");
+	piParam->setBoundVariable(&boxdyn, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: EQ1 Dyn Threshold
+	piParam = new PluginParameter(controlID::boxthresh, "EQ1 Dyn Threshold", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -30.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&boxthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: EQ1 Dyn Ratio
+	piParam = new PluginParameter(controlID::boxratio, "EQ1 Dyn Ratio", "", controlVariableType::kDouble, 1.000000, 20.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&boxratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: EQ2 Mode
+	piParam = new PluginParameter(controlID::sharpdyn, "EQ2 Mode", "Static,Dynamic", "Static");
+	piParam->setBoundVariable(&sharpdyn, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- continuous control: EQ2 Dyn Threshold
+	piParam = new PluginParameter(controlID::sharpthresh, "EQ2 Dyn Threshold", "dB", controlVariableType::kDouble, -60.000000, 0.000000, -30.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&sharpthresh, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: EQ2 Dyn Ratio
+	piParam = new PluginParameter(controlID::sharpratio, "EQ2 Dyn Ratio", "", controlVariableType::kDouble, 1.000000, 20.000000, 4.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&sharpratio, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- Aux Attributes
+	AuxParameterAttribute auxAttribute;
+
+	// --- RAFX GUI attributes
+	// --- controlID::boxgain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::boxgain, auxAttribute);
+
+	// --- controlID::sharpgain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::sharpgain, auxAttribute);
+
+	// --- controlID::airgain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::airgain, auxAttribute);
+
+	// --- controlID::boxfc
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::boxfc, auxAttribute);
+
+	// --- controlID::boxq
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::boxq, auxAttribute);
+
+	// --- controlID::inlvl
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::inlvl, auxAttribute);
+
+	// --- controlID::outlvl
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::outlvl, auxAttribute);
+
+	// --- controlID::sharpfc
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::sharpfc, auxAttribute);
+
+	// --- controlID::sharpq
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::sharpq, auxAttribute);
+
+	// --- controlID::airfc
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::airfc, auxAttribute);
+
+	// --- controlID::gatethresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::gatethresh, auxAttribute);
+
+	// --- controlID::gateattack
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::gateattack, auxAttribute);
+
+	// --- controlID::gaterelease
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::gaterelease, auxAttribute);
+
+	// --- controlID::gategain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::gategain, auxAttribute);
+
+	// --- controlID::compthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::compthresh, auxAttribute);
+
+	// --- controlID::compratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::compratio, auxAttribute);
+
+	// --- controlID::compattack
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::compattack, auxAttribute);
+
+	// --- controlID::comprelease
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::comprelease, auxAttribute);
+
+	// --- controlID::compgain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::compgain, auxAttribute);
+
+	// --- controlID::verbgain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::verbgain, auxAttribute);
+
+	// --- controlID::delayfb
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::delayfb, auxAttribute);
+
+	// --- controlID::delaytime
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::delaytime, auxAttribute);
+
+	// --- controlID::drygain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::drygain, auxAttribute);
+
+	// --- controlID::verbtime
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::verbtime, auxAttribute);
+
+	// --- controlID::preverbtime
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::preverbtime, auxAttribute);
+
+	// --- controlID::verbtime2
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::verbtime2, auxAttribute);
+
+	// --- controlID::delaydry
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::delaydry, auxAttribute);
+
+	// --- controlID::delaywet
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::delaywet, auxAttribute);
+
+	// --- controlID::eqmute
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(1073741825);
+	setParamAuxAttribute(controlID::eqmute, auxAttribute);
+
+	// --- controlID::bpmdelay
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::bpmdelay, auxAttribute);
+
+	// --- controlID::prein
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::prein, auxAttribute);
+
+	// --- controlID::presat
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::presat, auxAttribute);
+
+	// --- controlID::preass
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::preass, auxAttribute);
+
+	// --- controlID::preout
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::preout, auxAttribute);
+
+	// --- controlID::preampmute
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(1073741825);
+	setParamAuxAttribute(controlID::preampmute, auxAttribute);
+
+	// --- controlID::dynlink
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::dynlink, auxAttribute);
+
+	// --- controlID::sidechain
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::sidechain, auxAttribute);
+
+	// --- controlID::lookahead
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::lookahead, auxAttribute);
+
+	// --- controlID::verbmode
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::verbmode, auxAttribute);
+
+	// --- controlID::oversampling
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::oversampling, auxAttribute);
+
+	// --- controlID::chainorder
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::chainorder, auxAttribute);
+
+	// --- controlID::compmix
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::compmix, auxAttribute);
+
+	// --- controlID::compmode
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::compmode, auxAttribute);
+
+	// --- controlID::mbxoverlow
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbxoverlow, auxAttribute);
+
+	// --- controlID::mbxoverhigh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbxoverhigh, auxAttribute);
+
+	// --- controlID::mblowthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mblowthresh, auxAttribute);
+
+	// --- controlID::mblowratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mblowratio, auxAttribute);
+
+	// --- controlID::mblowattack
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mblowattack, auxAttribute);
+
+	// --- controlID::mblowrelease
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mblowrelease, auxAttribute);
+
+	// --- controlID::mbmidthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbmidthresh, auxAttribute);
+
+	// --- controlID::mbmidratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbmidratio, auxAttribute);
+
+	// --- controlID::mbmidattack
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbmidattack, auxAttribute);
+
+	// --- controlID::mbmidrelease
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbmidrelease, auxAttribute);
+
+	// --- controlID::mbhighthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbhighthresh, auxAttribute);
+
+	// --- controlID::mbhighratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbhighratio, auxAttribute);
+
+	// --- controlID::mbhighattack
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbhighattack, auxAttribute);
+
+	// --- controlID::mbhighrelease
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::mbhighrelease, auxAttribute);
+
+	// --- controlID::boxdyn
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::boxdyn, auxAttribute);
+
+	// --- controlID::boxthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::boxthresh, auxAttribute);
+
+	// --- controlID::boxratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::boxratio, auxAttribute);
+
+	// --- controlID::sharpdyn
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(268435456);
+	setParamAuxAttribute(controlID::sharpdyn, auxAttribute);
+
+	// --- controlID::sharpthresh
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::sharpthresh, auxAttribute);
+
+	// --- controlID::sharpratio
+	auxAttribute.reset(auxGUIIdentifier::guiControlData);
+	auxAttribute.setUintAttribute(2147483648);
+	setParamAuxAttribute(controlID::sharpratio, auxAttribute);
+
+
+	// **--0xEDA5--**
+   
+    // --- BONUS Parameter
+    // --- SCALE_GUI_SIZE
+    PluginParameter* piParamBonus = new PluginParameter(SCALE_GUI_SIZE, "Scale GUI", "tiny,small,medium,normal,large,giant", "normal");
+    addPluginParameter(piParamBonus);
+
+	// --- create the super fast access array
+	initPluginParameterArray();
+
+    return true;
+}
+
+/**
+\brief initialize object for a new run of audio; called just before audio streams
+
+Operation:
+- store sample rate and bit depth on audioProcDescriptor - this information is globally available to all core functions
+- reset your member objects here
+
+\param resetInfo structure of information about current audio format
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::reset(ResetInfo& resetInfo)
+{
+    // --- save for audio processing
+    audioProcDescriptor.sampleRate = resetInfo.sampleRate;
+    audioProcDescriptor.bitDepth = resetInfo.bitDepth;
+
+	 
+
+	ClassATubePreParameters preparams = preampL.getParameters();
+	preparams.highShelf_fc = 15000;
+	preparams.highShelfBoostCut_dB = 2.5;
+	preampL.setParameters(preparams);
+	preampR.setParameters(preparams);
+
+	const uint32_t kOversamplingFactors[] = { 1, 2, 4 };
+	preampOversampler.reset(kOversamplingFactors[std::min(std::max(oversampling, 0), 2)]);
+	preampBypassDelay.reset(preampOversampler.getLatency());
+	keyDelay.reset(preampOversampler.getLatency());
+	preampL.reset(resetInfo.sampleRate * preampOversampler.getFactor());
+	preampR.reset(resetInfo.sampleRate * preampOversampler.getFactor());
+
+	// --- stage bypass: the preamp restarts cold after being switched off, the EQ is kept warm
+	StageBypassParameters bypassParams;
+	bypassParams.resetWhenBypassed = true;
+	preampBypass.setParameters(bypassParams);
+	preampBypass.reset(resetInfo.sampleRate);
+
+	bypassParams.resetWhenBypassed = false;
+	eqBypass.setParameters(bypassParams);
+	eqBypass.reset(resetInfo.sampleRate);
+
+	// --- EQ: designed here once, synchronously; after this every redesign runs on the worker thread
+	eqDesign.parameters[kEQ_HPass].algorithm = filterAlgorithm::kHPF1;		// High Pass Filter at 200 Hz
+	eqDesign.parameters[kEQ_HPass].fc = 200;
+
+	eqDesign.parameters[kEQ_Notch1].algorithm = filterAlgorithm::kCQParaEQ;	// Parametric EQ 1
+	eqDesign.parameters[kEQ_Notch1].boostCut_dB = boxgain;
+	eqDesign.parameters[kEQ_Notch1].fc = boxfc;
+	eqDesign.parameters[kEQ_Notch1].Q = boxq;
+
+	eqDesign.parameters[kEQ_Notch2].algorithm = filterAlgorithm::kCQParaEQ;	// Parametric EQ 2
+	eqDesign.parameters[kEQ_Notch2].boostCut_dB = sharpgain;
+	eqDesign.parameters[kEQ_Notch2].fc = sharpfc;
+	eqDesign.parameters[kEQ_Notch2].Q = sharpq;
+
+	eqDesign.parameters[kEQ_HShelf].algorithm = filterAlgorithm::kHiShelf;		// High Shelf Filter
+	eqDesign.parameters[kEQ_HShelf].boostCut_dB = airgain;
+	eqDesign.parameters[kEQ_HShelf].fc = airfc;
+
+	eqDesign.sampleRate = resetInfo.sampleRate;
+	eqDesign.generation++;														// drops results still in flight for the old rate
+
+	CascadeDesignWorker::design(eqDesign, eqCoefficients);
+	EQ.reset(resetInfo.sampleRate);
+	EQ.setCoefficients(eqCoefficients.coeffs);
+	notch1Dyn.reset(resetInfo.sampleRate);
+	notch2Dyn.reset(resetInfo.sampleRate);
+	notch1Dyn.setDesign(eqCoefficients, kEQ_Notch1);
+	notch2Dyn.setDesign(eqCoefficients, kEQ_Notch2);
+	eqDynamicActive = false;
+	eqDesigner.start();
+
+	DynamicsProcessorParameters gateparams = Gate.getParameters();	// Gate (Downward Expander)
+	gateparams.calculation = dynamicsProcessorType::kDownwardExpander;
+	gateparams.hardLimitGate = true;								// makes the ratio to infinity
+	Gate.setParameters(gateparams);
+	Gate.reset(resetInfo.sampleRate);
+
+	DynamicsProcessorParameters compparams = Comp.getParameters();	// Compressor
+	compparams.calculation = dynamicsProcessorType::kCompressor;
+	Comp.setParameters(compparams);
+	Comp.reset(resetInfo.sampleRate);
+	mbComp.reset(resetInfo.sampleRate);							// Multiband compressor; parameters arrive with the first block
+
+	// --- lookahead is latched here, so the reported latency only changes on reset; all of its
+	//     buffers are allocated now and never during processing
+	lookaheadSamples = (uint32_t)(std::min(std::max(lookahead, 0.0), (double)kMaxLookahead_mSec) * 0.001 * resetInfo.sampleRate + 0.5);
+	Gate.setLookahead(lookaheadSamples);
+	Comp.setLookahead(lookaheadSamples);
+	lookaheadDelay.reset(lookaheadSamples);
+	pluginDescriptor.latencyInSamples = lookaheadSamples + preampOversampler.getLatency();
+
+	ReverbTankParameters verbparams = Verb.getParameters();			// Reverb
+	verbparams.density = reverbDensity::kThick;						// Thick Density
+	Verb.setParameters(verbparams);
+	Verb.reset(resetInfo.sampleRate);
+	fdnVerb.reset(resetInfo.sampleRate);
+	convVerb.reset(resetInfo.sampleRate);		// --- restarts its tail worker and reloads the IR off the audio thread
+
+	Delay.reset(resetInfo.sampleRate, kMaxDelay_mSec);			// Delay
+	outputMeter.reset(resetInfo.sampleRate);					// Loudness/true-peak meter; clears the integrated reading
+	spectrumAnalyzer.setSampleRate(resetInfo.sampleRate);		// EQ display; its worker follows the GUI, not reset( )
+
+	buildInsertChain();
+	compMix = compMixTarget = (float)(compmix / 100.0);
+
+	// --- objects were reset to their defaults; recompute everything on the next block
+	for (uint32_t stage = 0; stage < kNumStages; stage++)
+		stageRecomputeCount[stage] = 0;
+	lastBPM = -1.0;
+	dirtyStages.store(kAllStagesDirty, std::memory_order_release);
+
+    // --- other reset inits
+    return PluginBase::reset(resetInfo);
+}
+
+/**
+\brief one-time initialize function called after object creation and before the first reset( ) call
+
+Operation:
+- saves structure for the plugin to use; you can also load WAV files or state information here
+*/
+bool PluginCore::initialize(PluginInfo& pluginInfo)
+{
+	// --- add one-time init stuff here
+
+	// --- the convolution IR lives next to the plugin binary; it is loaded in reset( ) once the
+	//     sample rate is known
+	if (pluginInfo.pathToDLL)
+	{
+		std::string path(pluginInfo.pathToDLL);
+		size_t separator = path.find_last_of("/\\");
+		path = separator == std::string::npos ? std::string() : path.substr(0, separator + 1);
+		convVerb.setImpulseFile(path + kImpulseFileName);
+	}
+
+	return true;
+}
+
+/**
+\brief do anything needed prior to arrival of audio buffers
+
+Operation:
+- syncInBoundVariables when preProcessAudioBuffers is called, it is *guaranteed* that all GUI control change information
+  has been applied to plugin parameters; this binds parameter changes to your underlying variables
+- NOTE: postUpdatePluginParameter( ) will be called for all bound variables that are acutally updated; if you need to process
+  them individually, do so in that function
+- use this function to bulk-transfer the bound variable data into your plugin's member object variables
+
+\param processInfo structure of information about *buffer* processing
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
+{
+    // --- sync internal variables to GUI parameters; you can also do this manually if you don't
+    //     want to use the auto-variable-binding
+    syncInBoundVariables();
+
+    return true;
+}
+
+/**
+\brief frame-processing method
+
+Operation:
+- only used if the host path falls back to frames; runs one frame through processChannelStrip( ) so
+  that there is a single processing path
+- note that MIDI events are fired for each sample interval so that MIDI is tightly sunk with audio
+- doSampleAccurateParameterUpdates will perform per-sample interval smoothing
+
+\param processFrameInfo structure of information about *frame* processing
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
+{
+	// --- fire any MIDI events for this sample interval
+	if (processFrameInfo.midiEventQueue)
+		processFrameInfo.midiEventQueue->fireMidiEvents(processFrameInfo.currentFrame);
+
+	// --- do per-frame updates; VST automation and parameter smoothing
+	doSampleAccurateParameterUpdates();
+	double BPM = processFrameInfo.hostInfo->dBPM;
+	UpdateParameters(BPM);
+
+	bool stereoIn = processFrameInfo.channelIOConfig.inputChannelFormat == kCFStereo;
+	bool stereoOut = processFrameInfo.channelIOConfig.outputChannelFormat == kCFStereo;
+
+	float* inputR = stereoIn ? &processFrameInfo.audioInputFrame[1] : &processFrameInfo.audioInputFrame[0];
+	float* outputR = stereoOut ? &processFrameInfo.audioOutputFrame[1] : &processFrameInfo.audioOutputFrame[0];
+
+	// --- optional sidechain key from the aux input
+	const float* keyL = nullptr;
+	const float* keyR = nullptr;
+	if (processFrameInfo.auxAudioInputFrame && processFrameInfo.numAuxAudioInChannels > 0)
+	{
+		keyL = &processFrameInfo.auxAudioInputFrame[0];
+		keyR = processFrameInfo.numAuxAudioInChannels > 1 ? &processFrameInfo.auxAudioInputFrame[1] : keyL;
+	}
+
+	processChannelStrip(&processFrameInfo.audioInputFrame[0], inputR, &processFrameInfo.audioOutputFrame[0], outputR, 1, keyL, keyR);
+
+	return true; /// processed
+}
+
+/**
+\brief buffer-processing method
+
+Operation:
+- decides the channel routing once per buffer; mono inputs feed both sides of the strip and
+  mono outputs take the left side
+- breaks the buffer into chunks of at most kBlockSize frames; parameters are updated once per chunk
+  and each chunk runs through processChannelStrip( )
+
+\param processBufferInfo structure of information about *buffer* processing
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
+{
+	const ChannelIOConfig& ioConfig = processBufferInfo.channelIOConfig;
+	bool monoIn = ioConfig.inputChannelFormat == kCFMono;
+	bool stereoIn = ioConfig.inputChannelFormat == kCFStereo;
+	bool monoOut = ioConfig.outputChannelFormat == kCFMono;
+	bool stereoOut = ioConfig.outputChannelFormat == kCFStereo;
+
+	if (!(monoIn && (monoOut || stereoOut)) && !(stereoIn && stereoOut))
+		return false; /// NOT processed
+
+	// --- routing, once per buffer
+	const float* inputL = processBufferInfo.inputs[0];
+	const float* inputR = stereoIn ? processBufferInfo.inputs[1] : processBufferInfo.inputs[0];
+	float* outputL = processBufferInfo.outputs[0];
+	float* outputR = stereoOut ? processBufferInfo.outputs[1] : processBufferInfo.outputs[0];
+
+	// --- optional sidechain key from the aux input; mono keys feed both sides of the detector
+	const float* keyL = nullptr;
+	const float* keyR = nullptr;
+	if (processBufferInfo.auxAudioInBuffers && processBufferInfo.numAuxAudioInChannels > 0)
+	{
+		keyL = processBufferInfo.auxAudioInBuffers[0];
+		keyR = processBufferInfo.numAuxAudioInChannels > 1 ? processBufferInfo.auxAudioInBuffers[1] : keyL;
+	}
+
+	for (uint32_t start = 0; start < processBufferInfo.numFramesToProcess; start += kBlockSize)
+	{
+		uint32_t numFrames = processBufferInfo.numFramesToProcess - start;
+		if (numFrames > kBlockSize)
+			numFrames = kBlockSize;
+
+		// --- fire any MIDI events for this chunk
+		if (processBufferInfo.midiEventQueue)
+		{
+			for (uint32_t frame = start; frame < start + numFrames; frame++)
+				processBufferInfo.midiEventQueue->fireMidiEvents(frame);
+		}
+
+		// --- per-chunk updates; VST automation and parameter smoothing
+		doSampleAccurateParameterUpdates();
+		double BPM = processBufferInfo.hostInfo->dBPM;
+		UpdateParameters(BPM);
+
+		processChannelStrip(inputL + start, inputR + start, outputL + start, outputR + start, numFrames,
+							keyL ? keyL + start : nullptr, keyR ? keyR + start : nullptr);
+	}
+
+	return true; /// processed
+}
+
+/**
+\brief runs up to kBlockSize frames through the strip
+
+Operation:
+- insert chain (preamp; gate + comp; HPF, EQ1, EQ2, shelf) produces the dry path; each stage runs over
+  the whole chunk with separate left/right state, in the order chosen by chainorder (see
+  buildInsertChain( )); the preamp runs at 1x/2x/4x inside preampOversampler
+- the preamp and EQ mutes go through StageBypass: a muted stage is not run at all, and switching
+  either way crossfades over 10 ms
+- reverb and delay are parallel send buses fed from the dry path; both are set to wet-only output
+  in UpdateParameters( ) and each is processed exactly once per frame
+- the reverb bus is ReverbTank (per frame), FDNReverb or ConvolutionReverb (per block), selected by verbmode
+- mix: dry path * busDryGain + 0.6 * (reverb + delay), then output gain; busDryGain folds in the
+  reverb/delay dry controls so the balance matches the old in-line mix
+- outputR is written before outputL so that mono-out (outputR == outputL) keeps the left side; every
+  input sample is read before the output at the same index is written, so in-place buffers work
+
+\param inputL, inputR input channels (may be the same pointer)
+\param outputL, outputR output channels (may be the same pointer)
+\param numFrames number of frames, at most kBlockSize
+\param keyL, keyR sidechain key from the aux input, or nullptr when no aux input is connected
+*/
+void PluginCore::processChannelStrip(const float* inputL, const float* inputR, float* outputL, float* outputR, uint32_t numFrames,
+									 const float* keyL, const float* keyR)
+{
+	// --- insert chain: dry path, one stage at a time over the whole chunk
+	for (uint32_t i = 0; i < numFrames; i++)
+	{
+		dryL[i] = (float)(inputL[i] * gain_cooked_in);
+		dryR[i] = (float)(inputR[i] * gain_cooked_in);
+	}
+
+#if P1_STAGE_TELEMETRY
+	// --- telemetry: one flag read per block; each boundary is measured once and is the output of one
+	//     stage and the input of the next
+	const bool telemetry = telemetryEnabled.load(std::memory_order_relaxed);
+	StageLevels levels;
+	if (telemetry)
+		levels = measureStageLevels(dryL, dryR, numFrames);
+#endif
+
+	// --- preamp, dynamics and EQ in the order latched by buildInsertChain( )
+	for (uint32_t stage = 0; stage < kNumInsertStages; stage++)
+	{
+		(this->*insertChain[stage])(numFrames, keyL, keyR);
+
+#if P1_STAGE_TELEMETRY
+		if (telemetry)
+		{
+			telemetryRecord.input[insertTelemetryStage[stage]] = levels;
+			levels = measureStageLevels(dryL, dryR, numFrames);
+			telemetryRecord.output[insertTelemetryStage[stage]] = levels;
+		}
+#endif
+	}
+
+	// --- send buses: wet-only, one pass each
+	float inputFrame[2];
+	float wetFrame[2];
+
+	if (compareEnumToInt(verbmodeEnum::FDN, verbmode))
+	{
+		fdnVerb.processAudioBlock(dryL, dryR, reverbL, reverbR, numFrames);
+	}
+	else if (compareEnumToInt(verbmodeEnum::Convolution, verbmode))
+	{
+		convVerb.processAudioBlock(dryL, dryR, reverbL, reverbR, numFrames);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			inputFrame[0] = dryL[i];
+			inputFrame[1] = dryR[i];
+			Verb.processAudioFrame(inputFrame, wetFrame, 2, 2);
+			reverbL[i] = wetFrame[0];
+			reverbR[i] = wetFrame[1];
+		}
+	}
+
+	Delay.processAudioBlock(dryL, dryR, delayL, delayR, numFrames);
+
+	// --- mix
+	for (uint32_t i = 0; i < numFrames; i++)
+	{
+		double ynL = (busDryGain * dryL[i] + 0.6 * (reverbL[i] + delayL[i])) * gain_cooked_out;
+		double ynR = (busDryGain * dryR[i] + 0.6 * (reverbR[i] + delayR[i])) * gain_cooked_out;
+
+		outputR[i] = (float)ynR;
+		outputL[i] = (float)ynL;
+	}
+
+	// --- meter what was written; mono-out (outputR == outputL) is metered as one channel
+	outputMeter.processAudioBlock(outputL, outputR, numFrames);
+
+#if P1_STAGE_TELEMETRY
+	if (telemetry)
+		pushTelemetry(levels, outputL, outputR, numFrames);
+#endif
+}
+
+#if P1_STAGE_TELEMETRY
+/**
+\brief finishes this block's telemetry record and pushes it; a full ring drops the record and the
+count rides along with the next one that fits
+
+\param busLevels levels of the dry bus after the insert chain (the output stage's input)
+\param outputL, outputR the block as written to the outputs
+\param numFrames number of frames, at most kBlockSize
+*/
+void PluginCore::pushTelemetry(const StageLevels& busLevels, const float* outputL, const float* outputR, uint32_t numFrames)
+{
+	telemetryRecord.input[kTelemetryOutput] = busLevels;
+	telemetryRecord.output[kTelemetryOutput] = measureStageLevels(outputL, outputR, numFrames);
+
+	telemetryRecord.gateGain = blockMinimum(gateGains, numFrames);
+	if (compareEnumToInt(compmodeEnum::Multiband, compmode))
+	{
+		// --- multiband reports per-band reduction at the end of the block; take the deepest band
+		MultibandCompressorParameters mbparams = mbComp.getParameters();
+		double reduction_dB = 0.0;
+		for (uint32_t band = 0; band < MultibandCompressor::kNumBands; band++)
+			reduction_dB = std::min(reduction_dB, mbparams.gainReduction_dB[band]);
+		telemetryRecord.compGain = (float)pow(10.0, reduction_dB / 20.0);
+	}
+	else
+		telemetryRecord.compGain = blockMinimum(compGains, numFrames);
+
+	telemetryRecord.numFrames = numFrames;
+	telemetryRecord.droppedBefore = telemetryDropped;
+	if (telemetryRing.push(telemetryRecord))
+		telemetryDropped = 0;
+	else
+		telemetryDropped++;
+}
+
+/**
+\brief GUI thread: drains the telemetry ring and folds every record into telemetrySummary; peaks and
+gain reductions are the extremes since the last drain, RMS is frame-weighted over the same span
+
+\return true if at least one record was drained
+*/
+bool PluginCore::drainTelemetry()
+{
+	float inputPeak[kNumTelemetryStages] = { 0.0f };
+	float outputPeak[kNumTelemetryStages] = { 0.0f };
+	double inputEnergy[kNumTelemetryStages] = { 0.0 };
+	double outputEnergy[kNumTelemetryStages] = { 0.0 };
+	float gateGain = 1.0f;
+	float compGain = 1.0f;
+	uint64_t numFrames = 0;
+	uint32_t numBlocks = 0;
+	uint32_t droppedBlocks = 0;
+
+	StageTelemetryRecord record;
+	while (telemetryRing.pop(record))
+	{
+		for (uint32_t stage = 0; stage < kNumTelemetryStages; stage++)
+		{
+			inputPeak[stage] = std::max(inputPeak[stage], record.input[stage].peak);
+			outputPeak[stage] = std::max(outputPeak[stage], record.output[stage].peak);
+			inputEnergy[stage] += (double)record.input[stage].meanSquare * record.numFrames;
+			outputEnergy[stage] += (double)record.output[stage].meanSquare * record.numFrames;
+		}
+		gateGain = std::min(gateGain, record.gateGain);
+		compGain = std::min(compGain, record.compGain);
+		numFrames += record.numFrames;
+		numBlocks++;
+		droppedBlocks += record.droppedBefore;
+	}
+
+	if (numBlocks == 0 || numFrames == 0)
+		return false;
+
+	const double kFloor_dB = -120.0;
+	auto toDB = [kFloor_dB](double value) { return value > 0.0 ? std::max(20.0 * log10(value), kFloor_dB) : kFloor_dB; };
+	for (uint32_t stage = 0; stage < kNumTelemetryStages; stage++)
+	{
+		telemetrySummary.inputPeak_dB[stage] = toDB(inputPeak[stage]);
+		telemetrySummary.outputPeak_dB[stage] = toDB(outputPeak[stage]);
+		telemetrySummary.inputRMS_dB[stage] = toDB(sqrt(inputEnergy[stage] / (double)numFrames));
+		telemetrySummary.outputRMS_dB[stage] = toDB(sqrt(outputEnergy[stage] / (double)numFrames));
+	}
+	telemetrySummary.gateReduction_dB = toDB(gateGain);
+	telemetrySummary.compReduction_dB = toDB(compGain);
+	telemetrySummary.numBlocks = numBlocks;
+	telemetrySummary.droppedBlocks = droppedBlocks;
+	return true;
+}
+#endif
+
+/**
+\brief insert stage: tube preamp, oversampled; processes dryL/dryR in place
+
+\param numFrames number of frames, at most kBlockSize
+\param keyL, keyR unused
+*/
+void PluginCore::processPreampStage(uint32_t numFrames, const float* keyL, const float* keyR)
+{
+	// --- preamp: skipped outright when fully bypassed; the bypass path is kept running while the
+	//     preamp is on so it holds valid (latency-aligned) audio the moment a fade starts
+	preampBypass.setEnabled(preampmute == 0);
+	if (preampBypass.isBypassed())
+		preampBypassDelay.processAudioBlock(dryL, dryR, numFrames);
+	else
+	{
+		bool fading = preampBypass.isFading();
+		if (fading || preampBypassDelay.getDelaySamples() > 0)
+		{
+			std::copy(dryL, dryL + numFrames, bypassL);
+			std::copy(dryR, dryR + numFrames, bypassR);
+			preampBypassDelay.processAudioBlock(bypassL, bypassR, numFrames);
+		}
+
+		uint32_t highFrames = preampOversampler.upsample(dryL, dryR, numFrames);
+		float* highL = preampOversampler.getBufferL();
+		float* highR = preampOversampler.getBufferR();
+		for (uint32_t i = 0; i < highFrames; i++)
+		{
+			highL[i] = (float)preampL.processAudioSample(highL[i]);
+			highR[i] = (float)preampR.processAudioSample(highR[i]);
+		}
+		preampOversampler.downsample(dryL, dryR, numFrames);
+
+		if (fading && preampBypass.crossfade(bypassL, bypassR, dryL, dryR, numFrames))
+		{
+			// --- fully off now: start cold next time (the fade-in hides the filters refilling)
+			preampOversampler.clear();
+			preampL.reset(audioProcDescriptor.sampleRate * preampOversampler.getFactor());
+			preampR.reset(audioProcDescriptor.sampleRate * preampOversampler.getFactor());
+		}
+	}
+}
+
+/**
+\brief insert stage: gate and compressor with the shared lookahead; processes dryL/dryR in place
+
+\param numFrames number of frames, at most kBlockSize
+\param keyL, keyR sidechain key from the aux input, or nullptr when no aux input is connected
+*/
+void PluginCore::processDynamicsStage(uint32_t numFrames, const float* keyL, const float* keyR)
+{
+	// --- keep the aux key in step with the program when the preamp's latency is upstream
+	if (keyDelayed && keyL && keyR)
+	{
+		std::copy(keyL, keyL + numFrames, keyDelayL);
+		std::copy(keyR, keyR + numFrames, keyDelayR);
+		keyDelay.processAudioBlock(keyDelayL, keyDelayR, numFrames);
+		keyL = keyDelayL;
+		keyR = keyDelayR;
+	}
+
+	// --- stereo-linked dynamics; the key is only used when the sidechain switch is on External.
+	//     Both detectors run on the undelayed signal (the comp on the gated version of it) and both
+	//     gains land on the audio after the shared lookahead delay
+	Gate.computeGains(dryL, dryR, gateGains, numFrames, keyL, keyR);
+
+	if (compareEnumToInt(compmodeEnum::Multiband, compmode))
+	{
+		// --- multiband: the gate keeps its lookahead; the band detectors listen to the aligned, gated
+		//     program (no lookahead, no external key) and Comp Mix/Out Gain are handled inside mbComp
+		lookaheadDelay.processAudioBlock(dryL, dryR, numFrames);
+
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			dryL[i] *= gateGains[i];
+			dryR[i] *= gateGains[i];
+		}
+
+		mbComp.processAudioBlock(dryL, dryR, numFrames);
+		return;
+	}
+
+	for (uint32_t i = 0; i < numFrames; i++)
+	{
+		aheadL[i] = dryL[i] * gateGains[i];
+		aheadR[i] = dryR[i] * gateGains[i];
+	}
+
+	Comp.computeGains(aheadL, aheadR, compGains, numFrames, keyL, keyR);
+
+	lookaheadDelay.processAudioBlock(dryL, dryR, numFrames);
+
+	// --- parallel compression, fused into the gain pass: both paths are the same lookahead-delayed,
+	//     gated sample, so the dry path is aligned by construction (the oversampled preamp's latency is
+	//     upstream of both); the mix glides across the block so automating it does not zipper
+	float mixStep = (compMixTarget - compMix) / (float)numFrames;
+	for (uint32_t i = 0; i < numFrames; i++)
+	{
+		compMix += mixStep;
+		float gain = gateGains[i] * (1.0f + compMix * (compGains[i] - 1.0f));
+		dryL[i] *= gain;
+		dryR[i] *= gain;
+	}
+	compMix = compMixTarget;
+}
+
+/**
+\brief insert stage: HPF -> EQ1 -> EQ2 -> high shelf cascade; processes dryL/dryR in place
+
+\param numFrames number of frames, at most kBlockSize
+\param keyL, keyR unused
+*/
+void PluginCore::processEQStage(uint32_t numFrames, const float* keyL, const float* keyR)
+{
+	// --- EQ display taps: a copy of the block on each side of the EQ, nothing more on this thread
+	spectrumAnalyzer.capturePre(dryL, dryR, numFrames);
+
+	// --- EQ: skipped outright when fully bypassed; its state is frozen, not cleared, so switching it
+	//     back on resumes where it left off (coefficients keep updating on the worker meanwhile)
+	eqBypass.setEnabled(eqmute == 0);
+	if (!eqBypass.isBypassed())
+	{
+		if (eqDynamicActive || notch1Dyn.isEnabled() || notch2Dyn.isEnabled())
+			updateDynamicEQ(numFrames);
+
+		bool fading = eqBypass.isFading();
+		if (fading)
+		{
+			std::copy(dryL, dryL + numFrames, bypassL);
+			std::copy(dryR, dryR + numFrames, bypassR);
+		}
+
+		EQ.processAudioBlock(dryL, dryR, numFrames);
+
+		if (fading && eqBypass.crossfade(bypassL, bypassR, dryL, dryR, numFrames) && eqBypass.getParameters().resetWhenBypassed)
+			EQ.clearState();
+	}
+
+	spectrumAnalyzer.capturePost(dryL, dryR);
+}
+
+/**
+\brief dynamic EQ1/EQ2: runs the band detectors on the EQ input and glides the cascade, across this block,
+to the static table with the dynamic rows interpolated from the worker's gain tables for the new band gains
+(no filter design on this thread); after the last dynamic band is switched off it glides back to the static
+table once
+
+\param numFrames number of frames, at most kBlockSize
+*/
+void PluginCore::updateDynamicEQ(uint32_t numFrames)
+{
+	std::copy(&eqCoefficients.coeffs[0][0], &eqCoefficients.coeffs[0][0] + StereoBiquadCascade::kMaxSections*kNumBiquadCoeffs,
+			  &eqDynamicTable[0][0]);
+
+	bool active = false;
+	if (notch1Dyn.isEnabled())
+	{
+		notch1Dyn.detect(dryL, dryR, numFrames);
+		notch1Dyn.getCoefficients(eqDynamicTable[kEQ_Notch1]);
+		active = true;
+	}
+	if (notch2Dyn.isEnabled())
+	{
+		notch2Dyn.detect(dryL, dryR, numFrames);
+		notch2Dyn.getCoefficients(eqDynamicTable[kEQ_Notch2]);
+		active = true;
+	}
+
+	EQ.rampToCoefficients(eqDynamicTable);
+	eqDynamicActive = active;
+}
+
+/**
+\brief latches the insert order selected by chainorder into insertChain; called from reset( ) and
+from UpdateParameters( ) at a block boundary, so it only writes three pointers and never allocates
+*/
+void PluginCore::buildInsertChain()
+{
+	static const InsertStage kOrders[6][kNumInsertStages] = {
+		{ &PluginCore::processPreampStage, &PluginCore::processDynamicsStage, &PluginCore::processEQStage },	// Pre Dyn EQ
+		{ &PluginCore::processPreampStage, &PluginCore::processEQStage, &PluginCore::processDynamicsStage },	// Pre EQ Dyn
+		{ &PluginCore::processDynamicsStage, &PluginCore::processPreampStage, &PluginCore::processEQStage },	// Dyn Pre EQ
+		{ &PluginCore::processDynamicsStage, &PluginCore::processEQStage, &PluginCore::processPreampStage },	// Dyn EQ Pre
+		{ &PluginCore::processEQStage, &PluginCore::processPreampStage, &PluginCore::processDynamicsStage },	// EQ Pre Dyn
+		{ &PluginCore::processEQStage, &PluginCore::processDynamicsStage, &PluginCore::processPreampStage },	// EQ Dyn Pre
+	};
+
+	const InsertStage* order = kOrders[std::min(std::max(chainorder, 0), 5)];
+	std::copy(order, order + kNumInsertStages, insertChain);
+
+	// --- the key needs the preamp's latency whenever the preamp runs before the dynamics
+	const InsertStage* preamp = std::find(order, order + kNumInsertStages, &PluginCore::processPreampStage);
+	const InsertStage* dynamics = std::find(order, order + kNumInsertStages, &PluginCore::processDynamicsStage);
+	keyDelayed = preamp < dynamics && keyDelay.getDelaySamples() > 0;
+
+#if P1_STAGE_TELEMETRY
+	for (uint32_t stage = 0; stage < kNumInsertStages; stage++)
+	{
+		if (insertChain[stage] == &PluginCore::processPreampStage)
+			insertTelemetryStage[stage] = kTelemetryPreamp;
+		else if (insertChain[stage] == &PluginCore::processDynamicsStage)
+			insertTelemetryStage[stage] = kTelemetryDynamics;
+		else
+			insertTelemetryStage[stage] = kTelemetryEQ;
+	}
+#endif
+}
+
+#if P1_BENCHMARKS
+/**
+\brief benchmark driver: streams duration_Sec of stereo white noise through process(left, right, numFrames)
+	   in blockSize chunks. Each chunk is refilled from a fixed noise table first, so in-place processing
+	   never runs on its own output; the copy is timed too and costs the same for every contender.
+
+\return average time in nanoseconds per stereo frame
+*/
+template <typename Process>
+static double timeStereoBlocks(double sampleRate, uint32_t blockSize, double duration_Sec, Process process)
+{
+	const uint32_t kNoiseLength = 8192;
+	std::vector<float> noiseL(kNoiseLength + blockSize);
+	std::vector<float> noiseR(kNoiseLength + blockSize);
+	uint32_t seed = 22222;
+	for (uint32_t i = 0; i < kNoiseLength + blockSize; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		noiseL[i] = (float)(seed >> 8) / 16777216.0f - 0.5f;
+		seed = seed * 1664525u + 1013904223u;
+		noiseR[i] = (float)(seed >> 8) / 16777216.0f - 0.5f;
+	}
+
+	std::vector<float> left(blockSize);
+	std::vector<float> right(blockSize);
+	uint64_t numBlocks = std::max((uint64_t)(duration_Sec * sampleRate / blockSize), (uint64_t)1);
+	uint32_t position = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint64_t block = 0; block < numBlocks; block++)
+	{
+		std::copy(noiseL.begin() + position, noiseL.begin() + position + blockSize, left.begin());
+		std::copy(noiseR.begin() + position, noiseR.begin() + position + blockSize, right.begin());
+		process(left.data(), right.data(), blockSize);
+		position = (position + blockSize) % kNoiseLength;
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+	return elapsed.count() / (double)(numBlocks * blockSize);
+}
+
+/**
+\brief EQ benchmark: the four EQ sections at a typical setting (200 Hz high pass, -4 dB at 400 Hz, +3 dB
+	   at 3 kHz, +2 dB shelf at 10 kHz) run once as four AudioFilters per channel, one virtual call per
+	   filter and sample as the EQ stage used to, and once through StereoBiquadCascade::processAudioBlock( )
+
+\param sampleRate sample rate
+\param blockSize frames per block
+\param duration_Sec length of audio streamed through each contender
+
+\return cost of the AudioFilter chain (reference) and the fused cascade (optimized) in nSec per frame
+*/
+PluginCore::BenchmarkResult PluginCore::runEQCascadeBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec)
+{
+	StereoBiquadParameters sections[kNumEQSections];
+	sections[kEQ_HPass].algorithm = filterAlgorithm::kHPF1;
+	sections[kEQ_HPass].fc = 200.0;
+	sections[kEQ_Notch1].algorithm = filterAlgorithm::kCQParaEQ;
+	sections[kEQ_Notch1].fc = 400.0;
+	sections[kEQ_Notch1].Q = 1.5;
+	sections[kEQ_Notch1].boostCut_dB = -4.0;
+	sections[kEQ_Notch2].algorithm = filterAlgorithm::kCQParaEQ;
+	sections[kEQ_Notch2].fc = 3000.0;
+	sections[kEQ_Notch2].Q = 3.0;
+	sections[kEQ_Notch2].boostCut_dB = 3.0;
+	sections[kEQ_HShelf].algorithm = filterAlgorithm::kHiShelf;
+	sections[kEQ_HShelf].fc = 10000.0;
+	sections[kEQ_HShelf].boostCut_dB = 2.0;
+
+	AudioFilter filters[2][kNumEQSections];
+	StereoBiquadCascade cascade;
+	for (uint32_t section = 0; section < kNumEQSections; section++)
+	{
+		for (uint32_t channel = 0; channel < 2; channel++)
+		{
+			AudioFilterParameters params = filters[channel][section].getParameters();
+			params.algorithm = sections[section].algorithm;
+			params.fc = sections[section].fc;
+			params.Q = sections[section].Q;
+			params.boostCut_dB = sections[section].boostCut_dB;
+			filters[channel][section].reset(sampleRate);
+			filters[channel][section].setParameters(params);
+		}
+		cascade.setSectionParameters(section, sections[section]);
+	}
+	cascade.reset(sampleRate);
+
+	BenchmarkResult result;
+	result.reference_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			double xnL = left[i];
+			double xnR = right[i];
+			for (uint32_t section = 0; section < kNumEQSections; section++)
+			{
+				xnL = filters[0][section].processAudioSample(xnL);
+				xnR = filters[1][section].processAudioSample(xnR);
+			}
+			left[i] = (float)xnL;
+			right[i] = (float)xnR;
+		}
+	});
+
+	result.optimized_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		cascade.processAudioBlock(left, right, numFrames);
+	});
+	return result;
+}
+
+/**
+\brief the DynamicsProcessor gain curve evaluated in dB with log10( )/pow( ), as DynamicsProcessor::computeGain( )
+	   does per sample; the reference for runGainComputerBenchmark( ). Levels below -96 dB read -96 dB, as
+	   for DynamicsGainComputer, and a closed gate returns 0
+
+\param parameters curve settings
+\param level linear detector level
+
+\return linear gain
+*/
+static double referenceDynamicsGain(const DynamicsProcessorParameters& parameters, double level)
+{
+	double detect_dB = level <= 1.5848932e-5 ? -96.0 : 20.0*log10(level);
+	double overshoot = detect_dB - parameters.threshold_dB;
+	double kneeWidth = parameters.kneeWidth_dB;
+	double output_dB = detect_dB;
+
+	if (parameters.calculation == dynamicsProcessorType::kCompressor)
+	{
+		if (!parameters.softKnee || 2.0*overshoot > kneeWidth || 2.0*overshoot < -kneeWidth)
+		{
+			if (overshoot > 0.0)
+				output_dB = parameters.hardLimitGate ? parameters.threshold_dB : parameters.threshold_dB + overshoot / parameters.ratio;
+		}
+		else
+		{
+			double knee = overshoot + kneeWidth / 2.0;
+			if (parameters.hardLimitGate)
+				output_dB = detect_dB - knee*knee / (2.0*kneeWidth);
+			else
+				output_dB = detect_dB + ((1.0 / parameters.ratio) - 1.0)*knee*knee / (2.0*kneeWidth);
+		}
+	}
+	else
+	{
+		if (!parameters.softKnee || parameters.hardLimitGate || 2.0*overshoot > kneeWidth || 2.0*overshoot <= -kneeWidth)
+		{
+			if (overshoot < 0.0)
+			{
+				if (parameters.hardLimitGate)
+					return 0.0;
+				output_dB = parameters.threshold_dB + overshoot*parameters.ratio;
+			}
+		}
+		else
+		{
+			double knee = overshoot - kneeWidth / 2.0;
+			output_dB = detect_dB + (1.0 - parameters.ratio)*knee*knee / (2.0*kneeWidth);
+		}
+	}
+
+	return pow(10.0, (output_dB - detect_dB) / 20.0);
+}
+
+/**
+\brief gain computer benchmark. Accuracy: DynamicsGainComputer against referenceDynamicsGain( ) over
+	   detector levels from -120 dB to +24 dB in 0.01 dB steps, for soft and hard knee compressors, a
+	   soft knee limiter, soft and hard knee expanders and the gate. Speed: both evaluate the soft knee
+	   4:1 compressor curve at -20 dB for rectified noise, as detector levels, in blockSize chunks.
+
+\param sampleRate sample rate
+\param blockSize frames per block
+\param duration_Sec length of audio streamed through each contender
+
+\return cost of log10( )/pow( ) (reference) and DynamicsGainComputer (optimized) in nSec per level, and the
+		largest gain error in dB; a gate opening more than 0.001 dB away from the reference reads as infinite error
+*/
+PluginCore::BenchmarkResult PluginCore::runGainComputerBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec)
+{
+	struct CurveSetting
+	{
+		dynamicsProcessorType calculation;
+		bool softKnee;
+		bool hardLimitGate;
+		double ratio;
+		double threshold_dB;
+		double kneeWidth_dB;
+	};
+
+	const CurveSetting kSettings[] = {
+		{ dynamicsProcessorType::kCompressor, true, false, 4.0, -20.0, 10.0 },
+		{ dynamicsProcessorType::kCompressor, false, false, 50.0, -10.0, 10.0 },
+		{ dynamicsProcessorType::kCompressor, true, true, 4.0, -6.0, 6.0 },
+		{ dynamicsProcessorType::kDownwardExpander, true, false, 3.0, -40.0, 10.0 },
+		{ dynamicsProcessorType::kDownwardExpander, false, false, 2.0, -40.0, 10.0 },
+		{ dynamicsProcessorType::kDownwardExpander, true, true, 50.0, -50.0, 10.0 },
+	};
+
+	const uint32_t kNumLevels = 14401;
+	std::vector<float> levels(kNumLevels);
+	std::vector<float> gains(kNumLevels);
+	for (uint32_t i = 0; i < kNumLevels; i++)
+		levels[i] = (float)pow(10.0, (-120.0 + 0.01*i) / 20.0);
+
+	BenchmarkResult result;
+	DynamicsProcessorParameters params;
+	DynamicsGainComputer computer;
+
+	for (const CurveSetting& setting : kSettings)
+	{
+		params.calculation = setting.calculation;
+		params.softKnee = setting.softKnee;
+		params.hardLimitGate = setting.hardLimitGate;
+		params.ratio = setting.ratio;
+		params.threshold_dB = setting.threshold_dB;
+		params.kneeWidth_dB = setting.kneeWidth_dB;
+		computer.setParameters(params);
+		computer.processBlock(levels.data(), gains.data(), kNumLevels);
+
+		for (uint32_t i = 0; i < kNumLevels; i++)
+		{
+			double reference = referenceDynamicsGain(params, levels[i]);
+			if (reference == 0.0 || gains[i] == 0.0f)
+			{
+				// --- exactly at the threshold the two may round to opposite sides
+				if (reference != gains[i] && fabs(20.0*log10(levels[i]) - params.threshold_dB) > 0.001)
+					result.maxError_dB = HUGE_VAL;
+				continue;
+			}
+			result.maxError_dB = std::max(result.maxError_dB, fabs(20.0*log10(gains[i] / reference)));
+		}
+	}
+
+	// --- speed: the first setting; the left channel is rectified into levels, gains land in the right
+	params.calculation = kSettings[0].calculation;
+	params.softKnee = kSettings[0].softKnee;
+	params.hardLimitGate = kSettings[0].hardLimitGate;
+	params.ratio = kSettings[0].ratio;
+	params.threshold_dB = kSettings[0].threshold_dB;
+	params.kneeWidth_dB = kSettings[0].kneeWidth_dB;
+	computer.setParameters(params);
+
+	result.reference_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		for (uint32_t i = 0; i < numFrames; i++)
+			right[i] = (float)referenceDynamicsGain(params, fabs(left[i]));
+	});
+
+	result.optimized_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		for (uint32_t i = 0; i < numFrames; i++)
+			left[i] = fabs(left[i]);
+		computer.processBlock(left, right, numFrames);
+	});
+	return result;
+}
+
+/**
+\brief block adapter for ReverbTank: one processAudioFrame( ) call per frame, as the send bus runs it, behind
+	   the processAudioBlock( ) signature that measureReverbRT60( ) drives
+*/
+struct ReverbTankBlockAdapter
+{
+	ReverbTank& tank;
+
+	void processAudioBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t numFrames)
+	{
+		float inputFrame[2];
+		float wetFrame[2];
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			inputFrame[0] = inL[i];
+			inputFrame[1] = inR[i];
+			tank.processAudioFrame(inputFrame, wetFrame, 2, 2);
+			outL[i] = wetFrame[0];
+			outR[i] = wetFrame[1];
+		}
+	}
+};
+
+/**
+\brief reverb benchmark: ReverbTank (thick density, one processAudioFrame( ) call per frame as the send bus
+	   runs it) against FDNReverb::processAudioBlock( ), both set up from the same Verb Time, Predelay,
+	   Reverb Time and Verb Wet values exactly as UpdateParameters( ) maps them. After the timing runs
+	   both reverbs are reset and their RT60 is measured with measureReverbRT60( ), so the two decays
+	   can be compared alongside the costs.
+
+\param sampleRate sample rate
+\param blockSize frames per block
+\param duration_Sec length of audio streamed through each contender
+
+\return cost of ReverbTank (reference) and FDNReverb (optimized) in nSec per frame, and their measured RT60s
+*/
+PluginCore::BenchmarkResult PluginCore::runReverbBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec)
+{
+	const double kVerbTime_mSec = 50.0;
+	const double kPreDelay_mSec = 20.0;
+	const double kReverbTime = 0.5;
+	const double kWet_dB = -6.0;
+
+	ReverbTank tank;
+	tank.reset(sampleRate);
+	ReverbTankParameters verbparams = tank.getParameters();
+	verbparams.density = reverbDensity::kThick;
+	verbparams.fixeDelayMax_mSec = kVerbTime_mSec;
+	verbparams.preDelayTime_mSec = kPreDelay_mSec;
+	verbparams.dryLevel_dB = kSendBusMute_dB;
+	verbparams.wetLevel_dB = kWet_dB;
+	verbparams.kRT = kReverbTime;
+	tank.setParameters(verbparams);
+
+	FDNReverb fdn;
+	fdn.reset(sampleRate);
+	FDNReverbParameters fdnparams = fdn.getParameters();
+	fdnparams.size_mSec = kVerbTime_mSec;
+	fdnparams.rt60_Sec = 0.1 + 9.9 * kReverbTime * kReverbTime;
+	fdnparams.preDelay_mSec = kPreDelay_mSec;
+	fdnparams.wetLevel_dB = kWet_dB;
+	fdn.setParameters(fdnparams);
+
+	ReverbTankBlockAdapter tankBlock{ tank };
+	std::vector<float> wetL(blockSize);
+	std::vector<float> wetR(blockSize);
+
+	BenchmarkResult result;
+	result.reference_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		tankBlock.processAudioBlock(left, right, wetL.data(), wetR.data(), numFrames);
+	});
+
+	result.optimized_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		fdn.processAudioBlock(left, right, wetL.data(), wetR.data(), numFrames);
+	});
+
+	// --- decay times from freshly reset reverbs
+	tank.reset(sampleRate);
+	tank.setParameters(verbparams);
+	result.referenceRT60_Sec = measureReverbRT60(tankBlock, sampleRate);
+
+	fdn.reset(sampleRate);
+	fdn.setParameters(fdnparams);
+	result.optimizedRT60_Sec = measureReverbRT60(fdn, sampleRate);
+	return result;
+}
+
+/**
+\brief stage bypass benchmark: times the real processPreampStage( ) or processEQStage( ) on dryL/dryR with
+	   the stage switched on and with its mute switch on, at the current parameter settings (oversampling
+	   included). Both times are net of an empty pass that moves the same audio through dryL/dryR, so a
+	   bypassed stage that costs nothing reads as about zero. Each setting starts from a reset and runs
+	   half a second before it is timed, so the bypass crossfade is over; the mute switch is restored and
+	   the plugin reset again at the end.
+
+\param sampleRate sample rate to reset the plugin to
+\param blockSize frames per block, at most kBlockSize
+\param eqStage true to time the EQ stage, false for the preamp stage
+\param duration_Sec length of audio streamed through each setting
+
+\return cost of the stage switched on (reference) and bypassed (optimized) in nSec per frame
+*/
+PluginCore::BenchmarkResult PluginCore::runStageBypassBenchmark(double sampleRate, uint32_t blockSize, bool eqStage, double duration_Sec)
+{
+	blockSize = std::min(blockSize, (uint32_t)kBlockSize);
+	InsertStage stage = eqStage ? &PluginCore::processEQStage : &PluginCore::processPreampStage;
+	int& stageMute = eqStage ? eqmute : preampmute;
+	int savedMute = stageMute;
+
+	ResetInfo resetInfo;
+	resetInfo.sampleRate = sampleRate;
+	resetInfo.bitDepth = 32;
+
+	auto timeSetting = [&](int mute, bool runStage)
+	{
+		syncInBoundVariables();
+		stageMute = mute;
+		reset(resetInfo);
+		UpdateParameters(120.0);
+
+		auto pass = [&](float* left, float* right, uint32_t numFrames)
+		{
+			std::copy(left, left + numFrames, dryL);
+			std::copy(right, right + numFrames, dryR);
+			if (runStage)
+				(this->*stage)(numFrames, nullptr, nullptr);
+			std::copy(dryL, dryL + numFrames, left);
+			std::copy(dryR, dryR + numFrames, right);
+		};
+
+		timeStereoBlocks(sampleRate, blockSize, 0.5, pass);
+		return timeStereoBlocks(sampleRate, blockSize, duration_Sec, pass);
+	};
+
+	double empty_nSec = timeSetting(0, false);
+
+	BenchmarkResult result;
+	result.reference_nSec = timeSetting(0, true) - empty_nSec;
+	result.optimized_nSec = timeSetting(1, true) - empty_nSec;
+
+	stageMute = savedMute;
+	reset(resetInfo);
+	return result;
+}
+
+/**
+\brief multiband benchmark: one StereoDynamics compressor (gains computed, then applied to both channels,
+	   as the single-band Comp runs) against MultibandCompressor::processAudioBlock( ) with three bands
+	   at the same threshold, ratio and timing. Three independent compressors plus a crossover network
+	   would cost more than three times the reference; the vectorized bands should cost well under that.
+
+\param sampleRate sample rate
+\param blockSize frames per block
+\param duration_Sec length of audio streamed through each contender
+
+\return cost of StereoDynamics (reference) and MultibandCompressor (optimized) in nSec per frame
+*/
+PluginCore::BenchmarkResult PluginCore::runMultibandBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec)
+{
+	StereoDynamics single;
+	DynamicsProcessorParameters compparams = single.getParameters();
+	compparams.calculation = dynamicsProcessorType::kCompressor;
+	compparams.threshold_dB = -20.0;
+	compparams.ratio = 4.0;
+	compparams.attackTime_mSec = 10.0;
+	compparams.releaseTime_mSec = 150.0;
+	single.setParameters(compparams);
+	single.reset(sampleRate);
+
+	MultibandCompressor multiband;
+	MultibandCompressorParameters mbparams = multiband.getParameters();
+	for (uint32_t band = 0; band < MultibandCompressorParameters::kNumBands; band++)
+	{
+		mbparams.threshold_dB[band] = compparams.threshold_dB;
+		mbparams.ratio[band] = compparams.ratio;
+		mbparams.attackTime_mSec[band] = compparams.attackTime_mSec;
+		mbparams.releaseTime_mSec[band] = compparams.releaseTime_mSec;
+	}
+	multiband.setParameters(mbparams);
+	multiband.reset(sampleRate);
+
+	std::vector<float> gains(blockSize);
+
+	BenchmarkResult result;
+	result.reference_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		single.computeGains(left, right, gains.data(), numFrames);
+		for (uint32_t i = 0; i < numFrames; i++)
+		{
+			left[i] *= gains[i];
+			right[i] *= gains[i];
+		}
+	});
+
+	result.optimized_nSec = timeStereoBlocks(sampleRate, blockSize, duration_Sec, [&](float* left, float* right, uint32_t numFrames)
+	{
+		multiband.processAudioBlock(left, right, numFrames);
+	});
+	return result;
+}
+#endif
+
+/**
+\brief maps a controlID to the single stage it affects
+
+\param controlID the control ID value of the parameter
+
+\return the p1Stage to recompute, or -1 for controls that are read directly while processing (mute switches)
+*/
+int PluginCore::stageForControl(int32_t controlID)
+{
+	switch (controlID)
+	{
+		case controlID::inlvl:
+		case controlID::outlvl:
+			return kStageLevels;
+
+		case controlID::prein:
+		case controlID::presat:
+		case controlID::preass:
+		case controlID::preout:
+			return kStagePreamp;
+
+		case controlID::boxgain:
+		case controlID::boxfc:
+		case controlID::boxq:
+		case controlID::boxdyn:
+		case controlID::boxthresh:
+		case controlID::boxratio:
+			return kStageNotch1;
+
+		case controlID::sharpgain:
+		case controlID::sharpfc:
+		case controlID::sharpq:
+		case controlID::sharpdyn:
+		case controlID::sharpthresh:
+		case controlID::sharpratio:
+			return kStageNotch2;
+
+		case controlID::airgain:
+		case controlID::airfc:
+			return kStageHShelf;
+
+		case controlID::gatethresh:
+		case controlID::gateattack:
+		case controlID::gaterelease:
+		case controlID::gategain:
+			return kStageGate;
+
+		case controlID::compthresh:
+		case controlID::compratio:
+		case controlID::compattack:
+		case controlID::comprelease:
+		case controlID::compgain:
+		case controlID::compmix:
+			return kStageComp;
+
+		case controlID::dynlink:
+		case controlID::sidechain:
+			return kStageDynLink;
+
+		case controlID::mbxoverlow:
+		case controlID::mbxoverhigh:
+		case controlID::mblowthresh:
+		case controlID::mblowratio:
+		case controlID::mblowattack:
+		case controlID::mblowrelease:
+		case controlID::mbmidthresh:
+		case controlID::mbmidratio:
+		case controlID::mbmidattack:
+		case controlID::mbmidrelease:
+		case controlID::mbhighthresh:
+		case controlID::mbhighratio:
+		case controlID::mbhighattack:
+		case controlID::mbhighrelease:
+			return kStageMultiband;
+
+		case controlID::chainorder:
+			return kStageChain;
+
+		// --- lookahead and oversampling are latched in reset( ); the reverb engines and both compressors
+		//     always hold current parameters
+		case controlID::lookahead:
+		case controlID::oversampling:
+		case controlID::verbmode:
+		case controlID::compmode:
+			return -1;
+
+		case controlID::verbgain:
+		case controlID::verbtime:
+		case controlID::preverbtime:
+		case controlID::verbtime2:
+			return kStageVerb;
+
+		case controlID::delayfb:
+		case controlID::delaytime:
+		case controlID::delaywet:
+		case controlID::bpmdelay:
+			return kStageDelay;
+
+		case controlID::drygain:
+		case controlID::delaydry:
+			return kStageBusMix;
+
+		default:
+			return -1;
+	}
+}
+
+void PluginCore::UpdateParameters(double BPM)
+{
+	// --- block boundary: glide to the newest EQ coefficients from the worker, if any arrived; eqCoefficients
+	//     always holds the current static table (dynamic EQ bands are built on top of it)
+	if (eqDesigner.getCoefficients(eqIncoming) && eqIncoming.generation == eqDesign.generation)
+	{
+		eqCoefficients = eqIncoming;
+		EQ.rampToCoefficients(eqCoefficients.coeffs);
+		notch1Dyn.setDesign(eqCoefficients, kEQ_Notch1);
+		notch2Dyn.setDesign(eqCoefficients, kEQ_Notch2);
+	}
+
+	uint32_t dirty = dirtyStages.exchange(0, std::memory_order_acquire);
+
+	// --- the delay times follow the host tempo
+	if (BPM != lastBPM)
+	{
+		lastBPM = BPM;
+		dirty |= 1u << kStageDelay;
+	}
+
+	if (dirty == 0)
+		return;
+
+	if (dirty & (1u << kStageLevels))
+	{
+		gain_cooked_in = pow(10.0, inlvl / 20.0);
+		gain_cooked_out = pow(10.0, outlvl / 20.0);
+		stageRecomputeCount[kStageLevels]++;
+	}
+
+	if (dirty & (1u << kStagePreamp))
+	{
+		ClassATubePreParameters preparams = preampL.getParameters();
+		preparams.inputLevel_dB = prein;
+		preparams.saturation = presat;
+		preparams.asymmetry = preass;
+		preparams.outputLevel_dB = preout;
+		preampL.setParameters(preparams);
+		preampR.setParameters(preparams);
+		stageRecomputeCount[kStagePreamp]++;
+	}
+
+	if (dirty & (1u << kStageNotch1))
+	{
+		StereoBiquadParameters& notch1params = eqDesign.parameters[kEQ_Notch1];	// Parametric EQ 1
+		notch1params.boostCut_dB = boxgain;
+		notch1params.fc = boxfc;
+		notch1params.Q = boxq;
+
+		DynamicEQBandParameters dynparams = notch1Dyn.getParameters();
+		dynparams.enableDynamics = compareEnumToInt(boxdynEnum::Dynamic, boxdyn);
+		dynparams.threshold_dB = boxthresh;
+		dynparams.ratio = boxratio;
+		notch1Dyn.setParameters(dynparams);
+		stageRecomputeCount[kStageNotch1]++;
+	}
+
+	if (dirty & (1u << kStageNotch2))
+	{
+		StereoBiquadParameters& notch2params = eqDesign.parameters[kEQ_Notch2];	// Parametric EQ 2
+		notch2params.boostCut_dB = sharpgain;
+		notch2params.fc = sharpfc;
+		notch2params.Q = sharpq;
+
+		DynamicEQBandParameters dynparams = notch2Dyn.getParameters();
+		dynparams.enableDynamics = compareEnumToInt(sharpdynEnum::Dynamic, sharpdyn);
+		dynparams.threshold_dB = sharpthresh;
+		dynparams.ratio = sharpratio;
+		notch2Dyn.setParameters(dynparams);
+		stageRecomputeCount[kStageNotch2]++;
+	}
+
+	if (dirty & (1u << kStageHShelf))
+	{
+		StereoBiquadParameters& hshelfparams = eqDesign.parameters[kEQ_HShelf];	// High Shelf EQ
+		hshelfparams.boostCut_dB = airgain;
+		hshelfparams.fc = airfc;
+		stageRecomputeCount[kStageHShelf]++;
+	}
+
+	// --- hand the EQ design to the worker; the new coefficients are picked up at a later block boundary
+	if (dirty & ((1u << kStageNotch1) | (1u << kStageNotch2) | (1u << kStageHShelf)))
+	{
+		if (eqDesigner.isRunning())
+			eqDesigner.requestDesign(eqDesign);
+		else
+		{
+			// --- no worker (reset( ) not called yet); design in place
+			CascadeDesignWorker::design(eqDesign, eqCoefficients);
+			EQ.setCoefficients(eqCoefficients.coeffs);
+			notch1Dyn.setDesign(eqCoefficients, kEQ_Notch1);
+			notch2Dyn.setDesign(eqCoefficients, kEQ_Notch2);
+		}
+	}
+
+	if (dirty & (1u << kStageGate))
+	{
+		DynamicsProcessorParameters gateparams = Gate.getParameters();		// Gate
+		gateparams.threshold_dB = gatethresh;
+		// gateparams.gainReduction = gategainreduction;
+		gateparams.attackTime_mSec = gateattack;
+		gateparams.releaseTime_mSec = gaterelease;
+		gateparams.outputGain_dB = gategain;
+		Gate.setParameters(gateparams);
+		stageRecomputeCount[kStageGate]++;
+	}
+
+	if (dirty & (1u << kStageComp))
+	{
+		DynamicsProcessorParameters compparams = Comp.getParameters();		// Compressor
+		compparams.threshold_dB = compthresh;
+		compparams.ratio = compratio;
+		compparams.attackTime_mSec = compattack;
+		compparams.releaseTime_mSec = comprelease;
+		compparams.outputGain_dB = compgain;
+		Comp.setParameters(compparams);
+		compMixTarget = (float)(compmix / 100.0);
+		stageRecomputeCount[kStageComp]++;
+
+		dirty |= 1u << kStageMultiband;		// --- Comp Out Gain and Comp Mix are shared with the multiband compressor
+	}
+
+	if (dirty & (1u << kStageMultiband))
+	{
+		MultibandCompressorParameters mbparams = mbComp.getParameters();
+		mbparams.crossoverLow_Hz = mbxoverlow;
+		mbparams.crossoverHigh_Hz = mbxoverhigh;
+		mbparams.threshold_dB[0] = mblowthresh;
+		mbparams.ratio[0] = mblowratio;
+		mbparams.attackTime_mSec[0] = mblowattack;
+		mbparams.releaseTime_mSec[0] = mblowrelease;
+		mbparams.threshold_dB[1] = mbmidthresh;
+		mbparams.ratio[1] = mbmidratio;
+		mbparams.attackTime_mSec[1] = mbmidattack;
+		mbparams.releaseTime_mSec[1] = mbmidrelease;
+		mbparams.threshold_dB[2] = mbhighthresh;
+		mbparams.ratio[2] = mbhighratio;
+		mbparams.attackTime_mSec[2] = mbhighattack;
+		mbparams.releaseTime_mSec[2] = mbhighrelease;
+		mbparams.outputGain_dB = compgain;
+		mbparams.mix_Pct = compmix;
+		mbComp.setParameters(mbparams);
+		stageRecomputeCount[kStageMultiband]++;
+	}
+
+	if (dirty & (1u << kStageDynLink))
+	{
+		// --- gate and comp share the link mode and the key source
+		stereoLinkMode linkMode = compareEnumToInt(dynlinkEnum::RMS_Sum, dynlink) ? stereoLinkMode::kLinkRMSSum : stereoLinkMode::kLinkMax;
+		bool external = compareEnumToInt(sidechainEnum::External, sidechain);
+
+		Gate.setLinkMode(linkMode);
+		Comp.setLinkMode(linkMode);
+
+		DynamicsProcessorParameters gateparams = Gate.getParameters();
+		gateparams.enableSidechain = external;
+		Gate.setParameters(gateparams);
+
+		DynamicsProcessorParameters compparams = Comp.getParameters();
+		compparams.enableSidechain = external;
+		Comp.setParameters(compparams);
+		stageRecomputeCount[kStageDynLink]++;
+	}
+
+	if (dirty & (1u << kStageVerb))
+	{
+		ReverbTankParameters verbparams = Verb.getParameters();				// Reverb
+		verbparams.fixeDelayMax_mSec = verbtime;
+		verbparams.preDelayTime_mSec = preverbtime;
+		verbparams.dryLevel_dB = kSendBusMute_dB;							// wet-only send; dry is mixed in busDryGain
+		verbparams.wetLevel_dB = verbgain;
+		verbparams.kRT = verbtime2;
+		Verb.setParameters(verbparams);
+
+		// --- FDN: Verb Time sets the longest line, Reverb Time maps 0..1 to 0.1..10 s RT60
+		FDNReverbParameters fdnparams = fdnVerb.getParameters();
+		fdnparams.size_mSec = verbtime;
+		fdnparams.rt60_Sec = 0.1 + 9.9 * verbtime2 * verbtime2;
+		fdnparams.preDelay_mSec = preverbtime;
+		fdnparams.wetLevel_dB = verbgain;
+		fdnVerb.setParameters(fdnparams);
+
+		// --- convolution: the IR defines size and decay; only the wet level applies
+		ConvolutionReverbParameters convparams = convVerb.getParameters();
+		convparams.wetLevel_dB = verbgain;
+		convVerb.setParameters(convparams);
+		stageRecomputeCount[kStageVerb]++;
+	}
+
+	if (dirty & (1u << kStageDelay))
+	{
+		// --- a quarter note lasts 60000 / BPM milliseconds; without a host tempo, use Delay Time
+		const double kDivisions[] = { 1.0, 1.5, 0.5, 0.75 };				// Quarter, Dotted4, Eighth, Dotted8
+		double delay_mSec = delaytime;
+		if (BPM > 0.0)
+			delay_mSec = (60000.0 / BPM) * kDivisions[std::min(std::max(bpmdelay, 0), 3)];
+
+		StereoPingPongDelayParameters delayparams = Delay.getParameters();	// Delay
+		delayparams.delay_mSec = std::min(delay_mSec, (double)kMaxDelay_mSec);		// a tempo change glides to the new time
+		delayparams.feedback_Pct = delayfb;
+		delayparams.wetLevel_dB = delaywet;									// wet-only send; dry is mixed in busDryGain
+		Delay.setParameters(delayparams);
+		stageRecomputeCount[kStageDelay]++;
+	}
+
+	if (dirty & (1u << kStageChain))
+	{
+		buildInsertChain();
+		stageRecomputeCount[kStageChain]++;
+	}
+
+	if (dirty & (1u << kStageBusMix))
+	{
+		// --- the reverb and delay dry controls used to add the dry signal inside each object
+		busDryGain = 0.6 * (1.0 + pow(10.0, drygain / 20.0) + pow(10.0, delaydry / 20.0));
+		stageRecomputeCount[kStageBusMix]++;
+	}
+}
+
+/**
+\brief do anything needed prior to arrival of audio buffers
+
+Operation:
+- updateOutBoundVariables sends metering data to the GUI meters
+
+\param processInfo structure of information about *buffer* processing
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
+{
+	// --- update outbound variables; currently this is meter data only, but could be extended
+	//     in the future
+	updateOutBoundVariables();
+
+    return true;
+}
+
+/**
+\brief update the PluginParameter's value based on GUI control, preset, or data smoothing (thread-safe)
+
+Operation:
+- update the parameter's value (with smoothing this initiates another smoothing process)
+- call postUpdatePluginParameter to do any further processing
+
+\param controlID the control ID value of the parameter being updated
+\param controlValue the new control value
+\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo)
+{
+    // --- use base class helper
+    setPIParamValue(controlID, controlValue);
+
+    // --- do any post-processing
+    postUpdatePluginParameter(controlID, controlValue, paramInfo);
+
+    return true; /// handled
+}
+
+/**
+\brief update the PluginParameter's value based on *normlaized* GUI control, preset, or data smoothing (thread-safe)
+
+Operation:
+- update the parameter's value (with smoothing this initiates another smoothing process)
+- call postUpdatePluginParameter to do any further processing
+
+\param controlID the control ID value of the parameter being updated
+\param normalizedValue the new control value in normalized form
+\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo)
+{
+	// --- use base class helper, returns actual value
+	double controlValue = setPIParamValueNormalized(controlID, normalizedValue, paramInfo.applyTaper);
+
+	// --- do any post-processing
+	postUpdatePluginParameter(controlID, controlValue, paramInfo);
+
+	return true; /// handled
+}
+
+/**
+\brief perform any operations after the plugin parameter has been updated; this is one paradigm for
+	   transferring control information into vital plugin variables or member objects. If you use this
+	   method you can decode the control ID and then do any cooking that is needed. NOTE: do not
+	   overwrite bound variables here - this is ONLY for any extra cooking that is required to convert
+	   the GUI data to meaninful coefficients or other specific modifiers.
+
+\param controlID the control ID value of the parameter being updated
+\param controlValue the new control value
+\param paramInfo structure of information about why this value is being udpated (e.g as a result of a preset being loaded vs. the top of a buffer process cycle)
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo)
+{
+    // --- now do any post update cooking; be careful with VST Sample Accurate automation
+    //     If enabled, then make sure the cooking functions are short and efficient otherwise disable it
+    //     for the Parameter involved
+    //     Here we only mark the affected stage; the cooking happens once per block in UpdateParameters( )
+    int stage = stageForControl(controlID);
+    if (stage < 0)
+        return false;   /// not handled
+
+    markStageDirty(stage);
+    return true;    /// handled
+}
+
+/**
+\brief has nothing to do with actual variable or updated variable (binding)
+
+CAUTION:
+- DO NOT update underlying variables here - this is only for sending GUI updates or letting you
+  know that a parameter was changed; it should not change the state of your plugin.
+
+WARNING:
+- THIS IS NOT THE PREFERRED WAY TO LINK OR COMBINE CONTROLS TOGETHER. THE PROPER METHOD IS
+  TO USE A CUSTOM SUB-CONTROLLER THAT IS PART OF THE GUI OBJECT AND CODE.
+  SEE http://www.willpirkle.com for more information
+
+\param controlID the control ID value of the parameter being updated
+\param actualValue the new control value
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::guiParameterChanged(int32_t controlID, double actualValue)
+{
+	/*
+	switch (controlID)
+	{
+		case controlID::<your control here>
+		{
+
+			return true; // handled
+		}
+
+		default:
+			break;
+	}*/
+
+	return false; /// not handled
+}
+
+/**
+\brief For Custom View and Custom Sub-Controller Operations
+
+NOTES:
+- this is for advanced users only to implement custom view and custom sub-controllers
+- see the SDK for examples of use
+
+\param messageInfo a structure containing information about the incoming message
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::processMessage(MessageInfo& messageInfo)
+{
+	// --- decode message
+	switch (messageInfo.message)
+	{
+		// --- add customization appearance here
+	case PLUGINGUI_DIDOPEN:
+	{
+		return false;
+	}
+
+	// --- NULL pointers so that we don't accidentally use them
+	case PLUGINGUI_WILLCLOSE:
+	{
+		loudnessView = nullptr;
+		spectrumAnalyzer.stop();
+		spectrumView = nullptr;
+#if P1_STAGE_TELEMETRY
+		telemetryEnabled.store(false, std::memory_order_relaxed);
+		telemetryView = nullptr;
+#endif
+		return false;
+	}
+
+	// --- update view; this will only be called if the GUI is actually open
+	case PLUGINGUI_TIMERPING:
+	{
+		// --- the snapshot is only sent when the audio thread has published a newer one
+		if (loudnessView && outputMeter.getSnapshot(loudnessSnapshot))
+		{
+			loudnessView->sendMessage(&loudnessSnapshot);
+			loudnessView->updateView();
+		}
+		if (spectrumView && spectrumAnalyzer.getSnapshot(spectrumSnapshot))
+		{
+			spectrumView->sendMessage(&spectrumSnapshot);
+			spectrumView->updateView();
+		}
+#if P1_STAGE_TELEMETRY
+		if (telemetryView && drainTelemetry())
+		{
+			telemetryView->sendMessage(&telemetrySummary);
+			telemetryView->updateView();
+		}
+#endif
+		return false;
+	}
+
+	// --- register the custom view, grab the ICustomView interface
+	case PLUGINGUI_REGISTER_CUSTOMVIEW:
+	{
+		// --- the loudness meter view receives a LoudnessSnapshot* through sendMessage( )
+		if (messageInfo.inMessageString.compare(kLoudnessViewName) == 0)
+		{
+			loudnessView = static_cast<ICustomView*>(messageInfo.inMessageData);
+			return true;
+		}
+		// --- the spectrum view receives a SpectrumSnapshot*; the FFT worker runs while it is registered
+		if (messageInfo.inMessageString.compare(kSpectrumViewName) == 0)
+		{
+			spectrumView = static_cast<ICustomView*>(messageInfo.inMessageData);
+			spectrumAnalyzer.start();
+			return true;
+		}
+#if P1_STAGE_TELEMETRY
+		// --- the telemetry view receives a StageTelemetrySummary*; registering it switches measuring on
+		//     (records left over from an earlier session are discarded first)
+		if (messageInfo.inMessageString.compare(kTelemetryViewName) == 0)
+		{
+			telemetryRing.clear();
+			telemetryView = static_cast<ICustomView*>(messageInfo.inMessageData);
+			telemetryEnabled.store(true, std::memory_order_relaxed);
+			return true;
+		}
+#endif
+		return false;
+	}
+
+	case PLUGINGUI_REGISTER_SUBCONTROLLER:
+	case PLUGINGUI_QUERY_HASUSERCUSTOM:
+	case PLUGINGUI_USER_CUSTOMOPEN:
+	case PLUGINGUI_USER_CUSTOMCLOSE:
+	case PLUGINGUI_EXTERNAL_SET_NORMVALUE:
+	case PLUGINGUI_EXTERNAL_SET_ACTUALVALUE:
+	{
+
+		return false;
+	}
+
+	default:
+		break;
+	}
+
+	return false; /// not handled
+}
+
+
+/**
+\brief process a MIDI event
+
+NOTES:
+- MIDI events are 100% sample accurate; this function will be called repeatedly for every MIDI message
+- see the SDK for examples of use
+
+\param event a structure containing the MIDI event data
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::processMIDIEvent(midiEvent& event)
+{
+	return true;
+}
+
+/**
+\brief (for future use)
+
+NOTES:
+- MIDI events are 100% sample accurate; this function will be called repeatedly for every MIDI message
+- see the SDK for examples of use
+
+\param vectorJoysickData a structure containing joystick data
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData)
+{
+	return true;
+}
+
+/**
+\brief use this method to add new presets to the list
+
+NOTES:
+- see the SDK for examples of use
+- for non RackAFX users that have large paramter counts, there is a secret GUI control you
+  can enable to write C++ code into text files, one per preset. See the SDK or http://www.willpirkle.com for details
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::initPluginPresets()
+{
+	// **--0xFF7A--**
+
+	// --- Plugin Presets 
+	int index = 0;
+	PresetInfo* preset = nullptr;
+
+	// --- Preset: Factory Preset
+	preset = new PresetInfo(index++, "Factory Preset");
+	initPresetParameters(preset->presetParameters);
+	setPresetParameter(preset->presetParameters, controlID::boxgain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpgain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::airgain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxfc, 450.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxq, 6.000000);
+	setPresetParameter(preset->presetParameters, controlID::inlvl, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::outlvl, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpfc, 2500.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpq, 6.000000);
+	setPresetParameter(preset->presetParameters, controlID::airfc, 15000.000000);
+	setPresetParameter(preset->presetParameters, controlID::gatethresh, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::gateattack, 300.000000);
+	setPresetParameter(preset->presetParameters, controlID::gaterelease, 300.000000);
+	setPresetParameter(preset->presetParameters, controlID::gategain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::compthresh, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::compratio, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::compattack, 300.000000);
+	setPresetParameter(preset->presetParameters, controlID::comprelease, 300.000000);
+	setPresetParameter(preset->presetParameters, controlID::compgain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbgain, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::delayfb, 20.000000);
+	setPresetParameter(preset->presetParameters, controlID::delaytime, 50.000000);
+	setPresetParameter(preset->presetParameters, controlID::drygain, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbtime, 10.000000);
+	setPresetParameter(preset->presetParameters, controlID::preverbtime, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbtime2, 0.500000);
+	setPresetParameter(preset->presetParameters, controlID::delaydry, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::delaywet, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::eqmute, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::bpmdelay, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::prein, -3.000000);
+	setPresetParameter(preset->presetParameters, controlID::presat, 1.000000);
+	setPresetParameter(preset->presetParameters, controlID::preass, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::preout, -3.000000);
+	setPresetParameter(preset->presetParameters, controlID::preampmute, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::dynlink, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sidechain, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::lookahead, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbmode, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::oversampling, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::chainorder, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::compmix, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::compmode, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbxoverlow, 200.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbxoverhigh, 3000.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowattack, 20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowrelease, 250.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidattack, 10.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidrelease, 150.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighattack, 5.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighrelease, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxdyn, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxthresh, -30.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpdyn, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpthresh, -30.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpratio, 4.000000);
+	addPreset(preset);
+
+	// --- Preset: Pats Main Vocal
+	preset = new PresetInfo(index++, "Pats Main Vocal");
+	initPresetParameters(preset->presetParameters);
+	setPresetParameter(preset->presetParameters, controlID::boxgain, 2.879999);
+	setPresetParameter(preset->presetParameters, controlID::sharpgain, 3.120000);
+	setPresetParameter(preset->presetParameters, controlID::airgain, 3.480000);
+	setPresetParameter(preset->presetParameters, controlID::boxfc, 549.750000);
+	setPresetParameter(preset->presetParameters, controlID::boxq, 5.820000);
+	setPresetParameter(preset->presetParameters, controlID::inlvl, 5.639999);
+	setPresetParameter(preset->presetParameters, controlID::outlvl, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpfc, 2005.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpq, 6.000000);
+	setPresetParameter(preset->presetParameters, controlID::airfc, 13850.000000);
+	setPresetParameter(preset->presetParameters, controlID::gatethresh, -46.800003);
+	setPresetParameter(preset->presetParameters, controlID::gateattack, 1000.000000);
+	setPresetParameter(preset->presetParameters, controlID::gaterelease, 671.000000);
+	setPresetParameter(preset->presetParameters, controlID::gategain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::compthresh, -23.040001);
+	setPresetParameter(preset->presetParameters, controlID::compratio, 56.435001);
+	setPresetParameter(preset->presetParameters, controlID::compattack, 617.500000);
+	setPresetParameter(preset->presetParameters, controlID::comprelease, 486.999939);
+	setPresetParameter(preset->presetParameters, controlID::compgain, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbgain, -36.300003);
+	setPresetParameter(preset->presetParameters, controlID::delayfb, 40.000000);
+	setPresetParameter(preset->presetParameters, controlID::delaytime, 185.000000);
+	setPresetParameter(preset->presetParameters, controlID::drygain, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbtime, 2260.000000);
+	setPresetParameter(preset->presetParameters, controlID::preverbtime, 122.499985);
+	setPresetParameter(preset->presetParameters, controlID::verbtime2, 0.735000);
+	setPresetParameter(preset->presetParameters, controlID::delaydry, -60.000000);
+	setPresetParameter(preset->presetParameters, controlID::delaywet, -24.600002);
+	setPresetParameter(preset->presetParameters, controlID::eqmute, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::bpmdelay, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::prein, -3.000000);
+	setPresetParameter(preset->presetParameters, controlID::presat, 1.190000);
+	setPresetParameter(preset->presetParameters, controlID::preass, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::preout, -3.000000);
+	setPresetParameter(preset->presetParameters, controlID::preampmute, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::dynlink, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sidechain, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::lookahead, 0.000000);
+	setPresetParameter(preset->presetParameters, controlID::verbmode, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::oversampling, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::chainorder, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::compmix, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::compmode, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbxoverlow, 200.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbxoverhigh, 3000.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowattack, 20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mblowrelease, 250.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidattack, 10.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbmidrelease, 150.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighthresh, -20.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighattack, 5.000000);
+	setPresetParameter(preset->presetParameters, controlID::mbhighrelease, 100.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxdyn, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxthresh, -30.000000);
+	setPresetParameter(preset->presetParameters, controlID::boxratio, 4.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpdyn, -0.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpthresh, -30.000000);
+	setPresetParameter(preset->presetParameters, controlID::sharpratio, 4.000000);
+	addPreset(preset);
+
+
+	// **--0xA7FF--**
+
+    return true;
+}
+
+/**
+\brief setup the plugin description strings, flags and codes; this is ordinarily done through the ASPiKreator or CMake
+
+\return true if operation succeeds, false otherwise
+*/
+bool PluginCore::initPluginDescriptors()
+{
+    pluginDescriptor.pluginName = PluginCore::getPluginName();
+    pluginDescriptor.shortPluginName = PluginCore::getShortPluginName();
+    pluginDescriptor.vendorName = PluginCore::getVendorName();
+    pluginDescriptor.pluginTypeCode = PluginCore::getPluginType();
+
+	// --- describe the plugin attributes; set according to your needs
+	pluginDescriptor.hasSidechain = kWantSidechain;
+	pluginDescriptor.latencyInSamples = kLatencyInSamples;
+	pluginDescriptor.tailTimeInMSec = kTailTimeMsec;
+	pluginDescriptor.infiniteTailVST3 = kVSTInfiniteTail;
+
+    // --- AAX
+    apiSpecificInfo.aaxManufacturerID = kManufacturerID;
+    apiSpecificInfo.aaxProductID = kAAXProductID;
+    apiSpecificInfo.aaxBundleID = kAAXBundleID;  /* MacOS only: this MUST match the bundle identifier in your info.plist file */
+    apiSpecificInfo.aaxEffectID = "aaxDeveloper.";
+    apiSpecificInfo.aaxEffectID.append(PluginCore::getPluginName());
+    apiSpecificInfo.aaxPluginCategoryCode = kAAXCategory;
+
+    // --- AU
+    apiSpecificInfo.auBundleID = kAUBundleID;
+	apiSpecificInfo.auBundleName = kAUBundleName;   /* MacOS only: this MUST match the bundle identifier in your info.plist file */
+    apiSpecificInfo.auBundleName = kAUBundleName;
+
+    // --- VST3
+    apiSpecificInfo.vst3FUID = PluginCore::getVSTFUID(); // OLE string format
+    apiSpecificInfo.vst3BundleID = kVST3BundleID;/* MacOS only: this MUST match the bundle identifier in your info.plist file */
+	apiSpecificInfo.enableVST3SampleAccurateAutomation = kVSTSAA;
+	apiSpecificInfo.vst3SampleAccurateGranularity = kVST3SAAGranularity;
+
+    // --- AU and AAX
+    apiSpecificInfo.fourCharCode = PluginCore::getFourCharCode();
+
+    return true;
+}
+
+// --- static functions required for VST3/AU only --------------------------------------------- //
+const char* PluginCore::getPluginBundleName() { return kAUBundleName; }
+const char* PluginCore::getPluginName(){ return kPluginName; }
+const char* PluginCore::getShortPluginName(){ return kShortPluginName; }
+const char* PluginCore::getVendorName(){ return kVendorName; }
+const char* PluginCore::getVendorURL(){ return kVendorURL; }
+const char* PluginCore::getVendorEmail(){ return kVendorEmail; }
+const char* PluginCore::getAUCocoaViewFactoryName(){ return AU_COCOA_VIEWFACTORY_STRING; }
+pluginType PluginCore::getPluginType(){ return kPluginType; }
+const char* PluginCore::getVSTFUID(){ return kVSTFUID; }
+int32_t PluginCore::getFourCharCode(){ return kFourCharCode; }
@@ -1,293 +1,569 @@
-// -----------------------------------------------------------------------------
-//    ASPiK Plugin Kernel File:  plugincore.h
-//
-/**
-    \file   plugincore.h
-    \author Will Pirkle
-    \date   17-September-2018
-    \brief  base class interface file for ASPiK plugincore object
-    		- http://www.aspikplugins.com
-    		- http://www.willpirkle.com
-*/
-// -----------------------------------------------------------------------------
-#ifndef __pluginCore_h__
-#define __pluginCore_h__
-
-#include "pluginbase.h"
-#include "fxobjects.h"
-
-// **--0x7F1F--**
-
-// --- Plugin Variables controlID Enumeration 
-
-enum controlID {
-	boxgain = 0,
-	sharpgain = 1,
-	airgain = 2,
-	boxfc = 10,
-	boxq = 20,
-	inlvl = 40,
-	outlvl = 42,
-	sharpfc = 11,
-	sharpq = 21,
-	airfc = 12,
-	gatethresh = 4,
-	gateattack = 24,
-	gaterelease = 34,
-	gategain = 44,
-	compthresh = 5,
-	compratio = 15,
-	compattack = 25,
-	comprelease = 35,
-	compgain = 45,
-	verbgain = 7,
-	delayfb = 8,
-	delaytime = 18,
-	drygain = 17,
-	verbtime = 27,
-	preverbtime = 37,
-	verbtime2 = 47,
-	delaydry = 9,
-	delaywet = 19,
-	eqmute = 22,
-	bpmdelay = 28,
-	prein = 50,
-	presat = 51,
-	preass = 52,
-	preout = 53,
-	preampmute = 54
-};
-
-	// **--0x0F1F--**
-
-/**
-\class PluginCore
-\ingroup ASPiK-Core
-\brief
-The PluginCore object is the default PluginBase derived object for ASPiK projects.
-Note that you are fre to change the name of this object (as long as you change it in the compiler settings, etc...)
-
-
-PluginCore Operations:
-- overrides the main processing functions from the base class
-- performs reset operation on sub-modules
-- processes audio
-- processes messages for custom views
-- performs pre and post processing functions on parameters and audio (if needed)
-
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
-*/
-class PluginCore : public PluginBase
-{
-public:
-    PluginCore();
-
-	/** Destructor: empty in default version */
-    virtual ~PluginCore(){}
-
-	// --- PluginBase Overrides ---
-	//
-	/** this is the creation function for all plugin parameters */
-	bool initPluginParameters();
-
-	/** called when plugin is loaded, a new audio file is playing or sample rate changes */
-	virtual bool reset(ResetInfo& resetInfo);
-
-	/** one-time post creation init function; pluginInfo contains path to this plugin */
-	virtual bool initialize(PluginInfo& _pluginInfo);
-
-	// --- preProcess: sync GUI parameters here; override if you don't want to use automatic variable-binding
-	virtual bool preProcessAudioBuffers(ProcessBufferInfo& processInfo);
-
-	/** process frames of data */
-	virtual bool processAudioFrame(ProcessFrameInfo& processFrameInfo);
-
-	// --- uncomment and override this for buffer processing; see base class implementation for
-	//     help on breaking up buffers and getting info from processBufferInfo
-	//virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
-
-	/** preProcess: do any post-buffer processing required; default operation is to send metering data to GUI  */
-	virtual bool postProcessAudioBuffers(ProcessBufferInfo& processInfo);
-
-	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
-	virtual bool updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
-
-	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
-	virtual bool updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo);
-
-	/** this can be called: 1) after bound variable has been updated or 2) after smoothing occurs  */
-	virtual bool postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
-
-	/** this is ony called when the user makes a GUI control change */
-	virtual bool guiParameterChanged(int32_t controlID, double actualValue);
-
-	/** processMessage: messaging system; currently used for custom/special GUI operations */
-	virtual bool processMessage(MessageInfo& messageInfo);
-
-	/** processMIDIEvent: MIDI event processing */
-	virtual bool processMIDIEvent(midiEvent& event);
-
-	/** specialized joystick servicing (currently not used) */
-	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData);
-
-	/** create the presets */
-	bool initPluginPresets();
-
-	// --- BEGIN USER VARIABLES AND FUNCTIONS -------------------------------------- //
-	//	   Add your variables and methods here
-
-	void UpdateParameters(double BPM);
-
-	double gain_cooked_in = 1.0;
-	double gain_cooked_out = 1.0;
-
-	ClassATubePre preamp;
-
-	AudioFilter HPass;
-	AudioFilter Notch1;
-	AudioFilter Notch2;
-	AudioFilter HShelf;
-
-	DynamicsProcessor Gate;
-	DynamicsProcessor Comp;
-
-	ReverbTank Verb;
-	AudioDelay Delay;
-
-	HostInfo infoBPM;
-
-	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
-
-private:
-	//  **--0x07FD--**
-
-	// --- Continuous Plugin Variables 
-	double boxgain = 0.0;
-	double sharpgain = 0.0;
-	double airgain = 0.0;
-	double boxfc = 0.0;
-	double boxq = 0.0;
-	double inlvl = 0.0;
-	double outlvl = 0.0;
-	double sharpfc = 0.0;
-	double sharpq = 0.0;
-	double airfc = 0.0;
-	double gatethresh = 0.0;
-	double gateattack = 0.0;
-	double gaterelease = 0.0;
-	double gategain = 0.0;
-	double compthresh = 0.0;
-	double compratio = 0.0;
-	double compattack = 0.0;
-	double comprelease = 0.0;
-	double compgain = 0.0;
-	double verbgain = 0.0;
-	double delayfb = 0.0;
-	double delaytime = 0.0;
-	double drygain = 0.0;
-	double verbtime = 0.0;
-	double preverbtime = 0.0;
-	double verbtime2 = 0.0;
-	double delaydry = 0.0;
-	double delaywet = 0.0;
-	double prein = 0.0;
-	double presat = 0.0;
-	double preass = 0.0;
-	double preout = 0.0;
-
-	// --- Discrete Plugin Variables 
-	int eqmute = 0;
-	enum class eqmuteEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnumToInt(eqmuteEnum::SWITCH_OFF, eqmute)) etc... 
-
-	int bpmdelay = 0;
-	enum class bpmdelayEnum { Quarter,Dotted4,Eighth,Dotted8 };	// to compare: if(compareEnumToInt(bpmdelayEnum::Quarter, bpmdelay)) etc... 
-
-	int preampmute = 0;
-	enum class preampmuteEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnumToInt(preampmuteEnum::SWITCH_OFF, preampmute)) etc... 
-
-	// **--0x1A7F--**
-    // --- end member variables
-
-public:
-    /** static description: bundle folder name
-
-	\return bundle folder name as a const char*
-	*/
-    static const char* getPluginBundleName();
-
-    /** static description: name
-
-	\return name as a const char*
-	*/
-    static const char* getPluginName();
-
-	/** static description: short name
-
-	\return short name as a const char*
-	*/
-	static const char* getShortPluginName();
-
-	/** static description: vendor name
-
-	\return vendor name as a const char*
-	*/
-	static const char* getVendorName();
-
-	/** static description: URL
-
-	\return URL as a const char*
-	*/
-	static const char* getVendorURL();
-
-	/** static description: email
-
-	\return email address as a const char*
-	*/
-	static const char* getVendorEmail();
-
-	/** static description: Cocoa View Factory Name
-
-	\return Cocoa View Factory Name as a const char*
-	*/
-	static const char* getAUCocoaViewFactoryName();
-
-	/** static description: plugin type
-
-	\return type (FX or Synth)
-	*/
-	static pluginType getPluginType();
-
-	/** static description: VST3 GUID
-
-	\return VST3 GUID as a const char*
-	*/
-	static const char* getVSTFUID();
-
-	/** static description: 4-char code
-
-	\return 4-char code as int
-	*/
-	static int32_t getFourCharCode();
-
-	/** initalizer */
-	bool initPluginDescriptors();
-    
-    /** Status Window Messages for hosts that can show it */
-    void sendHostTextMessage(std::string messageString)
-    {
-        HostMessageInfo hostMessageInfo;
-        hostMessageInfo.hostMessage = sendRAFXStatusWndText;
-        hostMessageInfo.rafxStatusWndText.assign(messageString);
-        if(pluginHostConnector)
-            pluginHostConnector->sendHostMessage(hostMessageInfo);
-    }
-
-};
-
-
-
-
-#endif /* defined(__pluginCore_h__) */
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  plugincore.h
+//
+/**
+    \file   plugincore.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  base class interface file for ASPiK plugincore object
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef __pluginCore_h__
+#define __pluginCore_h__
+
+#include <atomic>
+
+#include "pluginbase.h"
+#include "fxobjects.h"
+#include "channelstrip.h"
+#include "fdnreverb.h"
+#include "convreverb.h"
+#include "loudness.h"
+#include "spectrum.h"
+
+// --- per-stage level and gain-reduction telemetry for the GUI; define as 0 to compile it out entirely
+#ifndef P1_STAGE_TELEMETRY
+#define P1_STAGE_TELEMETRY 1
+#endif
+
+// --- opt-in benchmarks of the optimized stages against the objects they replaced; define as 1 to
+//     compile them in. They allocate and take seconds to run, so never call them from a live session
+#ifndef P1_BENCHMARKS
+#define P1_BENCHMARKS 0
+#endif
+
+// **--0x7F1F--**
+
+// --- Plugin Variables controlID Enumeration 
+
+enum controlID {
+	boxgain = 0,
+	sharpgain = 1,
+	airgain = 2,
+	boxfc = 10,
+	boxq = 20,
+	inlvl = 40,
+	outlvl = 42,
+	sharpfc = 11,
+	sharpq = 21,
+	airfc = 12,
+	gatethresh = 4,
+	gateattack = 24,
+	gaterelease = 34,
+	gategain = 44,
+	compthresh = 5,
+	compratio = 15,
+	compattack = 25,
+	comprelease = 35,
+	compgain = 45,
+	verbgain = 7,
+	delayfb = 8,
+	delaytime = 18,
+	drygain = 17,
+	verbtime = 27,
+	preverbtime = 37,
+	verbtime2 = 47,
+	delaydry = 9,
+	delaywet = 19,
+	eqmute = 22,
+	bpmdelay = 28,
+	prein = 50,
+	presat = 51,
+	preass = 52,
+	preout = 53,
+	preampmute = 54,
+	dynlink = 60,
+	sidechain = 61,
+	lookahead = 62,
+	verbmode = 63,
+	oversampling = 64,
+	chainorder = 65,
+	compmix = 66,
+	compmode = 67,
+	mbxoverlow = 68,
+	mbxoverhigh = 69,
+	mblowthresh = 70,
+	mblowratio = 71,
+	mblowattack = 72,
+	mblowrelease = 73,
+	mbmidthresh = 74,
+	mbmidratio = 75,
+	mbmidattack = 76,
+	mbmidrelease = 77,
+	mbhighthresh = 78,
+	mbhighratio = 79,
+	mbhighattack = 80,
+	mbhighrelease = 81,
+	boxdyn = 82,
+	boxthresh = 83,
+	boxratio = 84,
+	sharpdyn = 85,
+	sharpthresh = 86,
+	sharpratio = 87
+};
+
+	// **--0x0F1F--**
+
+/**
+\class PluginCore
+\ingroup ASPiK-Core
+\brief
+The PluginCore object is the default PluginBase derived object for ASPiK projects.
+Note that you are fre to change the name of this object (as long as you change it in the compiler settings, etc...)
+
+
+PluginCore Operations:
+- overrides the main processing functions from the base class
+- performs reset operation on sub-modules
+- processes audio
+- processes messages for custom views
+- performs pre and post processing functions on parameters and audio (if needed)
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PluginCore : public PluginBase
+{
+public:
+    PluginCore();
+
+	/** Destructor: empty in default version */
+    virtual ~PluginCore(){}
+
+	// --- PluginBase Overrides ---
+	//
+	/** this is the creation function for all plugin parameters */
+	bool initPluginParameters();
+
+	/** called when plugin is loaded, a new audio file is playing or sample rate changes */
+	virtual bool reset(ResetInfo& resetInfo);
+
+	/** one-time post creation init function; pluginInfo contains path to this plugin */
+	virtual bool initialize(PluginInfo& _pluginInfo);
+
+	// --- preProcess: sync GUI parameters here; override if you don't want to use automatic variable-binding
+	virtual bool preProcessAudioBuffers(ProcessBufferInfo& processInfo);
+
+	/** process frames of data */
+	virtual bool processAudioFrame(ProcessFrameInfo& processFrameInfo);
+
+	/** process buffers of data; routing decided once per buffer, strip processed in kBlockSize chunks */
+	virtual bool processAudioBuffers(ProcessBufferInfo& processBufferInfo);
+
+	/** preProcess: do any post-buffer processing required; default operation is to send metering data to GUI  */
+	virtual bool postProcessAudioBuffers(ProcessBufferInfo& processInfo);
+
+	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
+	virtual bool updatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
+
+	/** called by host plugin at top of buffer proccess; this alters parameters prior to variable binding operation  */
+	virtual bool updatePluginParameterNormalized(int32_t controlID, double normalizedValue, ParameterUpdateInfo& paramInfo);
+
+	/** this can be called: 1) after bound variable has been updated or 2) after smoothing occurs  */
+	virtual bool postUpdatePluginParameter(int32_t controlID, double controlValue, ParameterUpdateInfo& paramInfo);
+
+	/** this is ony called when the user makes a GUI control change */
+	virtual bool guiParameterChanged(int32_t controlID, double actualValue);
+
+	/** processMessage: messaging system; currently used for custom/special GUI operations */
+	virtual bool processMessage(MessageInfo& messageInfo);
+
+	/** processMIDIEvent: MIDI event processing */
+	virtual bool processMIDIEvent(midiEvent& event);
+
+	/** specialized joystick servicing (currently not used) */
+	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData);
+
+	/** create the presets */
+	bool initPluginPresets();
+
+	// --- BEGIN USER VARIABLES AND FUNCTIONS -------------------------------------- //
+	//	   Add your variables and methods here
+
+	void UpdateParameters(double BPM);
+
+	// --- change detection: each control marks the one object it affects; UpdateParameters( ) only
+	//     recomputes dirty objects, at most once per block
+	enum p1Stage { kStageLevels, kStagePreamp, kStageNotch1, kStageNotch2, kStageHShelf, kStageGate, kStageComp,
+				   kStageDynLink, kStageMultiband, kStageVerb, kStageDelay, kStageBusMix, kStageChain, kNumStages };
+	static const uint32_t kAllStagesDirty = (1u << kNumStages) - 1;
+
+	std::atomic<uint32_t> dirtyStages{ kAllStagesDirty };
+	double lastBPM = -1.0;
+	uint32_t stageRecomputeCount[kNumStages] = { 0 };
+
+	static int stageForControl(int32_t controlID);
+	void markStageDirty(int stage) { dirtyStages.fetch_or(1u << stage, std::memory_order_relaxed); }
+
+	/** profiling: number of times a stage's parameters/coefficients were recomputed since the last reset */
+	uint32_t getStageRecomputeCount(int stage) const { return stage >= 0 && stage < kNumStages ? stageRecomputeCount[stage] : 0; }
+
+	double gain_cooked_in = 1.0;
+	double gain_cooked_out = 1.0;
+
+	// --- one tube preamp per channel; the gate, comp and EQ objects hold L/R state in vector lanes
+	ClassATubePre preampL;
+	ClassATubePre preampR;
+
+	// --- the preamps run inside the oversampler; the factor is latched in reset( ) and the muted
+	//     path is delayed by the same amount so the reported latency never changes
+	PolyphaseOversampler preampOversampler;
+	StereoDelayLine preampBypassDelay;
+	StageBypass preampBypass;
+
+	// --- EQ: HPF -> EQ1 -> EQ2 -> high shelf as one fused cascade
+	enum eqSection { kEQ_HPass, kEQ_Notch1, kEQ_Notch2, kEQ_HShelf, kNumEQSections };
+	StereoBiquadCascade EQ;
+	StageBypass eqBypass;
+
+	// --- EQ coefficients are designed on eqDesigner's thread; eqDesign is the audio thread's copy of
+	//     the requested filters and eqCoefficients receives the finished tables
+	CascadeDesignWorker eqDesigner;
+	CascadeDesign eqDesign;
+	CascadeCoefficients eqCoefficients;
+	CascadeCoefficients eqIncoming;
+
+	// --- dynamic EQ1/EQ2: detectors listen to the EQ input; while either band is dynamic the cascade
+	//     glides every block to eqCoefficients with those rows interpolated for the current band gains
+	DynamicEQBand notch1Dyn;
+	DynamicEQBand notch2Dyn;
+	double eqDynamicTable[StereoBiquadCascade::kMaxSections][kNumBiquadCoeffs] = { { 0.0 } };
+	bool eqDynamicActive = false;
+	void updateDynamicEQ(uint32_t numFrames);
+
+	StereoDynamics Gate;
+	StereoDynamics Comp;
+	MultibandCompressor mbComp;			// --- replaces Comp when compmode is Multiband
+
+	// --- reverb send: ReverbTank, the FDN or convolution, selected by verbmode; all get their
+	//     parameters so switching engines needs no recompute
+	ReverbTank Verb;
+	FDNReverb fdnVerb;
+	ConvolutionReverb convVerb;
+	const char* kImpulseFileName = "P1 Channel Strip IR.wav";
+	// --- tempo-synced send delay; the buffer holds kMaxDelay_mSec
+	static constexpr double kMaxDelay_mSec = 2000.0;
+	StereoPingPongDelay Delay;
+
+	// --- block processing; reverb and delay run as wet-only parallel send buses
+	static const uint32_t kBlockSize = 64;
+	static_assert(kBlockSize <= SpectrumCaptureBlock::kMaxFrames, "spectrum capture blocks must hold a whole processing block");
+	static constexpr double kSendBusMute_dB = -200.0;
+	double busDryGain = 1.8;
+
+	float dryL[kBlockSize] = { 0.0f };
+	float dryR[kBlockSize] = { 0.0f };
+	float reverbL[kBlockSize] = { 0.0f };
+	float reverbR[kBlockSize] = { 0.0f };
+	float delayL[kBlockSize] = { 0.0f };
+	float delayR[kBlockSize] = { 0.0f };
+
+	// --- unprocessed copy of a stage's input while its bypass crossfade runs
+	float bypassL[kBlockSize] = { 0.0f };
+	float bypassR[kBlockSize] = { 0.0f };
+
+	// --- dynamics lookahead: shared audio delay plus per-frame gate/comp gains
+	static constexpr double kMaxLookahead_mSec = 10.0;
+	uint32_t lookaheadSamples = 0;
+	StereoDelayLine lookaheadDelay;
+
+	float gateGains[kBlockSize] = { 0.0f };
+	float compGains[kBlockSize] = { 0.0f };
+	float aheadL[kBlockSize] = { 0.0f };
+	float aheadR[kBlockSize] = { 0.0f };
+
+	// --- sidechain key alignment: with the preamp ahead of the dynamics, the program reaches the detectors
+	//     late by the oversampler's latency, so keyDelay holds the aux key back by the same amount. It is
+	//     allocated in reset( ) and used while buildInsertChain( ) sets keyDelayed
+	StereoDelayLine keyDelay;
+	bool keyDelayed = false;
+	float keyDelayL[kBlockSize] = { 0.0f };
+	float keyDelayR[kBlockSize] = { 0.0f };
+
+	// --- compressor wet/dry: compMix glides to compMixTarget over one block
+	float compMix = 1.0f;
+	float compMixTarget = 1.0f;
+
+	// --- output metering: the audio thread publishes a snapshot every 100 ms; the GUI timer copies the
+	//     newest one into loudnessSnapshot and hands it to the registered loudness view
+	LoudnessMeter outputMeter;
+	LoudnessSnapshot loudnessSnapshot;
+	ICustomView* loudnessView = nullptr;
+	const char* kLoudnessViewName = "LoudnessView";
+
+	// --- EQ display: the EQ stage copies its input and output into spectrumAnalyzer, whose worker runs
+	//     only while the spectrum view is registered; the GUI timer forwards the newest snapshot
+	SpectrumAnalyzer spectrumAnalyzer;
+	SpectrumSnapshot spectrumSnapshot;
+	ICustomView* spectrumView = nullptr;
+	const char* kSpectrumViewName = "SpectrumView";
+
+	void processChannelStrip(const float* inputL, const float* inputR, float* outputL, float* outputR, uint32_t numFrames,
+							 const float* keyL = nullptr, const float* keyR = nullptr);
+
+	// --- reorderable insert chain: each stage processes dryL/dryR in place; insertChain holds the
+	//     current order and is rebuilt from chainorder at a block boundary
+	static const uint32_t kNumInsertStages = 3;
+	typedef void (PluginCore::*InsertStage)(uint32_t numFrames, const float* keyL, const float* keyR);
+	InsertStage insertChain[kNumInsertStages] = { nullptr };
+
+	void processPreampStage(uint32_t numFrames, const float* keyL, const float* keyR);
+	void processDynamicsStage(uint32_t numFrames, const float* keyL, const float* keyR);
+	void processEQStage(uint32_t numFrames, const float* keyL, const float* keyR);
+	void buildInsertChain();
+
+#if P1_STAGE_TELEMETRY
+	// --- stage telemetry: levels are measured at the stage boundaries, once per block, and one record
+	//     per block is pushed into telemetryRing; the GUI timer drains it into telemetrySummary for the
+	//     registered telemetry view. Measuring only runs while that view is registered
+	enum telemetryStage { kTelemetryPreamp, kTelemetryDynamics, kTelemetryEQ, kTelemetryOutput, kNumTelemetryStages };
+
+	struct StageTelemetryRecord
+	{
+		StageLevels input[kNumTelemetryStages];
+		StageLevels output[kNumTelemetryStages];
+		float gateGain = 1.0f;				// smallest gate gain in the block
+		float compGain = 1.0f;				// smallest compressor gain (largest band reduction in Multiband)
+		uint32_t numFrames = 0;
+		uint32_t droppedBefore = 0;			// records lost to a full ring just before this one
+	};
+
+	struct StageTelemetrySummary
+	{
+		double inputPeak_dB[kNumTelemetryStages] = { 0.0 };
+		double inputRMS_dB[kNumTelemetryStages] = { 0.0 };
+		double outputPeak_dB[kNumTelemetryStages] = { 0.0 };
+		double outputRMS_dB[kNumTelemetryStages] = { 0.0 };
+		double gateReduction_dB = 0.0;		// largest reduction since the last summary, <= 0
+		double compReduction_dB = 0.0;
+		uint32_t numBlocks = 0;
+		uint32_t droppedBlocks = 0;
+	};
+
+	static const uint32_t kTelemetryCapacity = 256;
+	SpscRing<StageTelemetryRecord, kTelemetryCapacity> telemetryRing;
+	std::atomic<bool> telemetryEnabled{ false };
+
+	// --- audio thread
+	StageTelemetryRecord telemetryRecord;
+	uint32_t telemetryDropped = 0;
+	uint32_t insertTelemetryStage[kNumInsertStages] = { kTelemetryPreamp, kTelemetryDynamics, kTelemetryEQ };
+	void pushTelemetry(const StageLevels& busLevels, const float* outputL, const float* outputR, uint32_t numFrames);
+
+	// --- GUI thread
+	StageTelemetrySummary telemetrySummary;
+	ICustomView* telemetryView = nullptr;
+	const char* kTelemetryViewName = "StageTelemetryView";
+	bool drainTelemetry();
+#endif
+
+#if P1_BENCHMARKS
+	// --- benchmarks: stereo white noise is streamed through a reference and the optimized path at the
+	//     same settings; both costs are reported in nSec per stereo frame
+	struct BenchmarkResult
+	{
+		double reference_nSec = 0.0;
+		double optimized_nSec = 0.0;
+		double maxError_dB = 0.0;		///< accuracy benchmarks only: largest deviation from the reference
+		double referenceRT60_Sec = 0.0;	///< reverb benchmark only: measured decay time of the reference
+		double optimizedRT60_Sec = 0.0;	///< reverb benchmark only: measured decay time of the optimized path
+	};
+
+	/** four AudioFilters per channel, as the EQ used to run, against the fused StereoBiquadCascade */
+	static BenchmarkResult runEQCascadeBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec = 10.0);
+
+	/** DynamicsGainComputer against the log10/pow DynamicsProcessor curve: accuracy sweep and cost per level */
+	static BenchmarkResult runGainComputerBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec = 10.0);
+
+	/** ReverbTank, one frame at a time, against FDNReverb's block path at the same settings; also measures both RT60s */
+	static BenchmarkResult runReverbBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec = 10.0);
+
+	/** the real preamp or EQ insert stage switched on against bypassed; resets the plugin */
+	BenchmarkResult runStageBypassBenchmark(double sampleRate, uint32_t blockSize, bool eqStage, double duration_Sec = 10.0);
+
+	/** one StereoDynamics compressor against the three-band MultibandCompressor */
+	static BenchmarkResult runMultibandBenchmark(double sampleRate, uint32_t blockSize, double duration_Sec = 10.0);
+#endif
+
+	HostInfo infoBPM;
+
+	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
+
+private:
+	//  **--0x07FD--**
+
+	// --- Continuous Plugin Variables 
+	double boxgain = 0.0;
+	double sharpgain = 0.0;
+	double airgain = 0.0;
+	double boxfc = 0.0;
+	double boxq = 0.0;
+	double inlvl = 0.0;
+	double outlvl = 0.0;
+	double sharpfc = 0.0;
+	double sharpq = 0.0;
+	double airfc = 0.0;
+	double gatethresh = 0.0;
+	double gateattack = 0.0;
+	double gaterelease = 0.0;
+	double gategain = 0.0;
+	double compthresh = 0.0;
+	double compratio = 0.0;
+	double compattack = 0.0;
+	double comprelease = 0.0;
+	double compgain = 0.0;
+	double verbgain = 0.0;
+	double delayfb = 0.0;
+	double delaytime = 0.0;
+	double drygain = 0.0;
+	double verbtime = 0.0;
+	double preverbtime = 0.0;
+	double verbtime2 = 0.0;
+	double delaydry = 0.0;
+	double delaywet = 0.0;
+	double prein = 0.0;
+	double presat = 0.0;
+	double preass = 0.0;
+	double preout = 0.0;
+	double lookahead = 0.0;
+	double compmix = 0.0;
+	double mbxoverlow = 0.0;
+	double mbxoverhigh = 0.0;
+	double mblowthresh = 0.0;
+	double mblowratio = 0.0;
+	double mblowattack = 0.0;
+	double mblowrelease = 0.0;
+	double mbmidthresh = 0.0;
+	double mbmidratio = 0.0;
+	double mbmidattack = 0.0;
+	double mbmidrelease = 0.0;
+	double mbhighthresh = 0.0;
+	double mbhighratio = 0.0;
+	double mbhighattack = 0.0;
+	double mbhighrelease = 0.0;
+	double boxthresh = 0.0;
+	double boxratio = 0.0;
+	double sharpthresh = 0.0;
+	double sharpratio = 0.0;
+
+	// --- Discrete Plugin Variables 
+	int eqmute = 0;
+	enum class eqmuteEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnumToInt(eqmuteEnum::SWITCH_OFF, eqmute)) etc... 
+
+	int bpmdelay = 0;
+	enum class bpmdelayEnum { Quarter,Dotted4,Eighth,Dotted8 };	// to compare: if(compareEnumToInt(bpmdelayEnum::Quarter, bpmdelay)) etc... 
+
+	int preampmute = 0;
+	enum class preampmuteEnum { SWITCH_OFF,SWITCH_ON };	// to compare: if(compareEnumToInt(preampmuteEnum::SWITCH_OFF, preampmute)) etc... 
+
+	int dynlink = 0;
+	enum class dynlinkEnum { Max,RMS_Sum };	// to compare: if(compareEnumToInt(dynlinkEnum::Max, dynlink)) etc... 
+
+	int sidechain = 0;
+	enum class sidechainEnum { Internal,External };	// to compare: if(compareEnumToInt(sidechainEnum::Internal, sidechain)) etc... 
+
+	int verbmode = 0;
+	enum class verbmodeEnum { Tank,FDN,Convolution };	// to compare: if(compareEnumToInt(verbmodeEnum::Tank, verbmode)) etc... 
+
+	int oversampling = 0;
+	enum class oversamplingEnum { Off,x2,x4 };	// to compare: if(compareEnumToInt(oversamplingEnum::Off, oversampling)) etc... 
+
+	int chainorder = 0;
+	enum class chainorderEnum { Pre_Dyn_EQ,Pre_EQ_Dyn,Dyn_Pre_EQ,Dyn_EQ_Pre,EQ_Pre_Dyn,EQ_Dyn_Pre };	// to compare: if(compareEnumToInt(chainorderEnum::Pre_Dyn_EQ, chainorder)) etc... 
+
+	int compmode = 0;
+	enum class compmodeEnum { Single,Multiband };	// to compare: if(compareEnumToInt(compmodeEnum::Single, compmode)) etc... 
+
+	int boxdyn = 0;
+	enum class boxdynEnum { Static,Dynamic };	// to compare: if(compareEnumToInt(boxdynEnum::Static, boxdyn)) etc... 
+
+	int sharpdyn = 0;
+	enum class sharpdynEnum { Static,Dynamic };	// to compare: if(compareEnumToInt(sharpdynEnum::Static, sharpdyn)) etc... 
+
+	// **--0x1A7F--**
+    // --- end member variables
+
+public:
+    /** static description: bundle folder name
+
+	\return bundle folder name as a const char*
+	*/
+    static const char* getPluginBundleName();
+
+    /** static description: name
+
+	\return name as a const char*
+	*/
+    static const char* getPluginName();
+
+	/** static description: short name
+
+	\return short name as a const char*
+	*/
+	static const char* getShortPluginName();
+
+	/** static description: vendor name
+
+	\return vendor name as a const char*
+	*/
+	static const char* getVendorName();
+
+	/** static description: URL
+
+	\return URL as a const char*
+	*/
+	static const char* getVendorURL();
+
+	/** static description: email
+
+	\return email address as a const char*
+	*/
+	static const char* getVendorEmail();
+
+	/** static description: Cocoa View Factory Name
+
+	\return Cocoa View Factory Name as a const char*
+	*/
+	static const char* getAUCocoaViewFactoryName();
+
+	/** static description: plugin type
+
+	\return type (FX or Synth)
+	*/
+	static pluginType getPluginType();
+
+	/** static description: VST3 GUID
+
+	\return VST3 GUID as a const char*
+	*/
+	static const char* getVSTFUID();
+
+	/** static description: 4-char code
+
+	\return 4-char code as int
+	*/
+	static int32_t getFourCharCode();
+
+	/** initalizer */
+	bool initPluginDescriptors();
+    
+    /** Status Window Messages for hosts that can show it */
+    void sendHostTextMessage(std::string messageString)
+    {
+        HostMessageInfo hostMessageInfo;
+        hostMessageInfo.hostMessage = sendRAFXStatusWndText;
+        hostMessageInfo.rafxStatusWndText.assign(messageString);
+        if(pluginHostConnector)
+            pluginHostConnector->sendHostMessage(hostMessageInfo);
+    }
+
+};
+
+
+
+
+#endif /* defined(__pluginCore_h__) */
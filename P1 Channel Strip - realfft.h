@@ -0,0 +1,244 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip DSP:  realfft.h
+//
+/**
+    \file   realfft.h
+    \brief  power-of-two real FFT shared by the P1 Channel Strip convolution reverb and spectrum analyzer
+    		- RealFFT: half-size complex radix-2 FFT plus a split step
+*/
+// -----------------------------------------------------------------------------
+#ifndef __realFFT_h__
+#define __realFFT_h__
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FFT_SSE2 1
+#else
+#define FFT_SSE2 0
+#endif
+
+/**
+\class RealFFT
+\ingroup P1-Objects
+\brief
+Real FFT of a power-of-two size N. The N real samples are packed into an N/2-point complex signal
+(even samples real, odd samples imaginary), transformed with an iterative radix-2 FFT and split into
+bins 0..N/2. Spectra are kept split (separate re/im arrays) so spectral multiplies vectorize.
+
+- initialize( ) allocates the tables and work buffers; forward( )/inverse( ) never allocate
+- inverse( ) is unnormalized: inverse(forward(x)) = (N/2) * x
+- not thread safe; each thread needs its own instance
+*/
+class RealFFT
+{
+public:
+	RealFFT() {}
+	~RealFFT() {}
+
+	/** allocate tables for an N-point transform; N must be a power of two >= 4 */
+	void initialize(uint32_t _size)
+	{
+		size = _size;
+		half = size / 2;
+
+		bitReverse.resize(half);
+		uint32_t bits = 0;
+		while ((1u << bits) < half)
+			bits++;
+		for (uint32_t i = 0; i < half; i++)
+		{
+			uint32_t reversed = 0;
+			for (uint32_t b = 0; b < bits; b++)
+				reversed |= ((i >> b) & 1u) << (bits - 1 - b);
+			bitReverse[i] = reversed;
+		}
+
+		// --- twiddles for the half-size complex FFT, stored per stage so each stage reads them contiguously:
+		//     stage with span S uses entries [S - 1, 2S - 1), w_j = exp(-j 2 pi j / 2S)
+		stageCos.resize(std::max(1u, half));
+		stageSin.resize(std::max(1u, half));
+		for (uint32_t span = 1; span < half; span <<= 1)
+		{
+			for (uint32_t j = 0; j < span; j++)
+			{
+				stageCos[span - 1 + j] = (float)cos(kPi * j / span);
+				stageSin[span - 1 + j] = (float)sin(kPi * j / span);
+			}
+		}
+		splitCos.resize(half);
+		splitSin.resize(half);
+		for (uint32_t k = 0; k < half; k++)
+		{
+			splitCos[k] = (float)cos(2.0 * kPi * k / size);
+			splitSin[k] = (float)sin(2.0 * kPi * k / size);
+		}
+
+		workRe.assign(half, 0.0f);
+		workIm.assign(half, 0.0f);
+	}
+
+	uint32_t getSize() const { return size; }
+	uint32_t getNumBins() const { return half + 1; }
+
+	/** N real samples in, bins 0..N/2 out */
+	void forward(const float* input, float* re, float* im)
+	{
+		for (uint32_t n = 0; n < half; n++)
+		{
+			workRe[n] = input[2 * n];
+			workIm[n] = input[2 * n + 1];
+		}
+		complexFFT(workRe.data(), workIm.data(), false);
+
+		re[0] = workRe[0] + workIm[0];
+		im[0] = 0.0f;
+		re[half] = workRe[0] - workIm[0];
+		im[half] = 0.0f;
+
+		for (uint32_t k = 1; k < half; k++)
+		{
+			// --- even part E = (Z[k] + conj Z[M-k]) / 2, odd part O = (Z[k] - conj Z[M-k]) / 2j
+			float zr = workRe[k], zi = workIm[k];
+			float cr = workRe[half - k], ci = -workIm[half - k];
+			float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+			float orr = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+
+			// --- X[k] = E + W^k O, W = exp(-j 2 pi / N)
+			float c = splitCos[k], s = splitSin[k];
+			re[k] = er + c * orr + s * oi;
+			im[k] = ei + c * oi - s * orr;
+		}
+	}
+
+	/** bins 0..N/2 in, N real samples out, scaled by N/2 */
+	void inverse(const float* re, const float* im, float* output)
+	{
+		for (uint32_t k = 0; k < half; k++)
+		{
+			float xr = re[k], xi = im[k];
+			float cr = re[half - k], ci = -im[half - k];
+			float er = 0.5f * (xr + cr), ei = 0.5f * (xi + ci);
+			float dr = 0.5f * (xr - cr), di = 0.5f * (xi - ci);
+
+			// --- O = D * W^-k, then Z[k] = E + jO
+			float c = splitCos[k], s = splitSin[k];
+			float orr = dr * c - di * s;
+			float oi = dr * s + di * c;
+			workRe[k] = er - oi;
+			workIm[k] = ei + orr;
+		}
+		complexFFT(workRe.data(), workIm.data(), true);
+
+		for (uint32_t n = 0; n < half; n++)
+		{
+			output[2 * n] = workRe[n];
+			output[2 * n + 1] = workIm[n];
+		}
+	}
+
+protected:
+	static constexpr double kPi = 3.14159265358979323846;
+
+	uint32_t size = 0;
+	uint32_t half = 0;
+	std::vector<uint32_t> bitReverse;
+	std::vector<float> stageCos;
+	std::vector<float> stageSin;
+	std::vector<float> splitCos;
+	std::vector<float> splitSin;
+	std::vector<float> workRe;
+	std::vector<float> workIm;
+
+	/** in-place iterative radix-2 DIT FFT of length N/2; inverse is unnormalized */
+	void complexFFT(float* re, float* im, bool inverse)
+	{
+		for (uint32_t i = 0; i < half; i++)
+		{
+			uint32_t j = bitReverse[i];
+			if (j > i)
+			{
+				std::swap(re[i], re[j]);
+				std::swap(im[i], im[j]);
+			}
+		}
+
+		const float sign = inverse ? 1.0f : -1.0f;
+		uint32_t firstSpan = 1;
+
+		// --- spans 1 and 2 fused as one radix-4 pass (twiddles 1 and -/+j), which avoids the
+		//     per-group loop overhead of the two shortest stages
+		if (half >= 4)
+		{
+			for (uint32_t start = 0; start < half; start += 4)
+			{
+				float* r = re + start;
+				float* i = im + start;
+				float t0r = r[0] + r[1], t0i = i[0] + i[1];
+				float t1r = r[0] - r[1], t1i = i[0] - i[1];
+				float t2r = r[2] + r[3], t2i = i[2] + i[3];
+				float t3r = r[2] - r[3], t3i = i[2] - i[3];
+
+				// --- w * t3 with w = (0, sign)
+				float ur = -sign * t3i, ui = sign * t3r;
+				r[0] = t0r + t2r;	i[0] = t0i + t2i;
+				r[2] = t0r - t2r;	i[2] = t0i - t2i;
+				r[1] = t1r + ur;	i[1] = t1i + ui;
+				r[3] = t1r - ur;	i[3] = t1i - ui;
+			}
+			firstSpan = 4;
+		}
+
+		for (uint32_t span = firstSpan; span < half; span <<= 1)
+		{
+			const float* wCos = stageCos.data() + span - 1;
+			const float* wSin = stageSin.data() + span - 1;
+			for (uint32_t start = 0; start < half; start += 2 * span)
+			{
+				uint32_t j = 0;
+#if FFT_SSE2
+				// --- four butterflies at a time once the span allows it
+				const __m128 vSign = _mm_set1_ps(sign);
+				for (; j + 4 <= span; j += 4)
+				{
+					float* aRe = re + start + j;
+					float* aIm = im + start + j;
+					float* bRe = aRe + span;
+					float* bIm = aIm + span;
+
+					__m128 wr = _mm_loadu_ps(wCos + j);
+					__m128 wi = _mm_mul_ps(vSign, _mm_loadu_ps(wSin + j));
+					__m128 xr = _mm_loadu_ps(bRe), xi = _mm_loadu_ps(bIm);
+					__m128 tr = _mm_sub_ps(_mm_mul_ps(xr, wr), _mm_mul_ps(xi, wi));
+					__m128 ti = _mm_add_ps(_mm_mul_ps(xr, wi), _mm_mul_ps(xi, wr));
+					__m128 ar = _mm_loadu_ps(aRe), ai = _mm_loadu_ps(aIm);
+					_mm_storeu_ps(bRe, _mm_sub_ps(ar, tr));
+					_mm_storeu_ps(bIm, _mm_sub_ps(ai, ti));
+					_mm_storeu_ps(aRe, _mm_add_ps(ar, tr));
+					_mm_storeu_ps(aIm, _mm_add_ps(ai, ti));
+				}
+#endif
+				for (; j < span; j++)
+				{
+					float wr = wCos[j];
+					float wi = sign * wSin[j];
+
+					uint32_t a = start + j;
+					uint32_t b = a + span;
+					float tr = re[b] * wr - im[b] * wi;
+					float ti = re[b] * wi + im[b] * wr;
+					re[b] = re[a] - tr;
+					im[b] = im[a] - ti;
+					re[a] += tr;
+					im[a] += ti;
+				}
+			}
+		}
+	}
+};
+
+#endif
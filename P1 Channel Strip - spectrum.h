@@ -0,0 +1,302 @@
+// -----------------------------------------------------------------------------
+//    P1 Channel Strip analysis:  spectrum.h
+//
+/**
+    \file   spectrum.h
+    \brief  pre/post-EQ spectrum analyzer for the P1 Channel Strip EQ display
+    		- SpectrumCaptureBlock: one block of EQ input and output as copied by the audio thread
+    		- SpectrumSnapshot: smoothed 1/12-octave magnitudes published to the GUI
+    		- SpectrumAnalyzer: capture ring on the audio side, windowed FFTs on its own worker thread
+*/
+// -----------------------------------------------------------------------------
+#ifndef __spectrum_h__
+#define __spectrum_h__
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "lockfree.h"
+#include "realfft.h"
+
+/**
+\struct SpectrumCaptureBlock
+\ingroup P1-Objects
+\brief
+One captured block: the EQ input (pre) and output (post), both channels, up to kMaxFrames frames.
+*/
+struct SpectrumCaptureBlock
+{
+	static const uint32_t kMaxFrames = 64;
+
+	float preL[kMaxFrames];
+	float preR[kMaxFrames];
+	float postL[kMaxFrames];
+	float postR[kMaxFrames];
+	uint32_t numFrames = 0;
+};
+
+/**
+\struct SpectrumSnapshot
+\ingroup P1-Objects
+\brief
+Smoothed magnitudes in 1/12-octave bands from 20 Hz up; dB relative to a full-scale sine, floored at
+kFloor_dB. Bands above Nyquist read the floor.
+*/
+struct SpectrumSnapshot
+{
+	static const uint32_t kNumBands = 120;
+	static constexpr float kFloor_dB = -120.0f;
+
+	float frequency_Hz[kNumBands] = { 0.0f };		///< geometric band centres
+	float pre_dB[kNumBands] = { 0.0f };				///< EQ input
+	float post_dB[kNumBands] = { 0.0f };			///< EQ output
+	uint32_t sequence = 0;							///< increments with every publish
+};
+
+/**
+\class SpectrumAnalyzer
+\ingroup P1-Objects
+\brief
+Spectrum feed for the EQ display. The audio thread only copies: capturePre( ) and capturePost( ) write
+the EQ input and output straight into a free slot of an SpscRing, and nothing else happens there. A
+worker thread drains the ring, sums each tap to mono and, every kHopSize samples, runs a Hann-windowed
+kFFTSize-point RealFFT per tap (50 % overlap), takes the strongest bin in each 1/12-octave band and
+smooths the result in dB with separate rise and fall times before publishing a SpectrumSnapshot
+through a TripleBuffer for the GUI timer. The worker sleeps on a WorkerWakeup that capturePost( )
+signals, so it does not poll an empty ring.
+
+- the FFTs and every buffer are set up in the constructor; the worker never allocates
+- start( )/stop( ) from the GUI thread (view registered/closing); capture is a no-op while stopped
+- capturePre( )/capturePost( ) from the audio thread only, once each per block; a full ring drops
+  the block
+- setSampleRate( ) from reset( ); the worker rebuilds its band map when the rate changes
+*/
+class SpectrumAnalyzer
+{
+public:
+	SpectrumAnalyzer()
+	{
+		fft.initialize(kFFTSize);
+
+		// --- Hann window; a full-scale sine peaks at 2|X| / sum(w) = 1
+		double windowSum = 0.0;
+		for (uint32_t n = 0; n < kFFTSize; n++)
+		{
+			window[n] = (float)(0.5 - 0.5 * cos(2.0 * 3.14159265358979323846 * n / kFFTSize));
+			windowSum += window[n];
+		}
+		magnitudeScale_dB = (float)(20.0 * log10(2.0 / windowSum));
+	}
+	~SpectrumAnalyzer() { stop(); }
+
+	SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+	SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+	static const uint32_t kFFTSize = 2048;
+	static const uint32_t kHopSize = kFFTSize / 2;
+	static const uint32_t kNumBins = kFFTSize / 2 + 1;
+	static const uint32_t kNumBands = SpectrumSnapshot::kNumBands;
+	static const uint32_t kRingBlocks = 128;
+
+	/** the rate the captured audio runs at */
+	void setSampleRate(double _sampleRate) { sampleRate.store(_sampleRate, std::memory_order_relaxed); }
+
+	/** launch the worker and enable capture; stale blocks from an earlier run are discarded */
+	void start()
+	{
+		if (running.exchange(true))
+			return;
+		ring.clear();
+		worker = std::thread(&SpectrumAnalyzer::run, this);
+		capturing.store(true, std::memory_order_relaxed);
+	}
+
+	/** disable capture, then stop and join the worker */
+	void stop()
+	{
+		capturing.store(false, std::memory_order_relaxed);
+		running.store(false);
+		wakeup.notify();
+		if (worker.joinable())
+			worker.join();
+	}
+
+	/** audio thread: copy the EQ input; claims a ring slot when the analyzer is running */
+	void capturePre(const float* left, const float* right, uint32_t numFrames)
+	{
+		slot = capturing.load(std::memory_order_relaxed) ? ring.beginWrite() : nullptr;
+		if (!slot)
+			return;
+
+		slot->numFrames = std::min(numFrames, (uint32_t)SpectrumCaptureBlock::kMaxFrames);
+		memcpy(slot->preL, left, slot->numFrames * sizeof(float));
+		memcpy(slot->preR, right, slot->numFrames * sizeof(float));
+	}
+
+	/** audio thread: copy the EQ output and hand the block to the worker */
+	void capturePost(const float* left, const float* right)
+	{
+		if (!slot)
+			return;
+
+		memcpy(slot->postL, left, slot->numFrames * sizeof(float));
+		memcpy(slot->postR, right, slot->numFrames * sizeof(float));
+		ring.commitWrite();
+		slot = nullptr;
+		wakeup.notify();
+	}
+
+	/** GUI thread: copy the newest spectrum; returns false if nothing new was published */
+	bool getSnapshot(SpectrumSnapshot& snapshot)
+	{
+		if (!snapshots.update())
+			return false;
+		snapshot = snapshots.getReadBuffer();
+		return true;
+	}
+
+protected:
+	// --- shared
+	SpscRing<SpectrumCaptureBlock, kRingBlocks> ring;
+	TripleBuffer<SpectrumSnapshot> snapshots;
+	std::atomic<double> sampleRate{ 44100.0 };
+	std::atomic<bool> capturing{ false };
+	std::atomic<bool> running{ false };
+	WorkerWakeup wakeup;
+	std::thread worker;
+
+	// --- audio thread
+	SpectrumCaptureBlock* slot = nullptr;
+
+	// --- worker thread
+	RealFFT fft;
+	float window[kFFTSize];
+	float magnitudeScale_dB = 0.0f;
+
+	float history[2][kFFTSize] = { { 0.0f } };		///< mono pre/post, circular
+	uint32_t writePosition = 0;
+	uint32_t samplesSinceFFT = 0;
+
+	float frame[kFFTSize];
+	float re[kNumBins];
+	float im[kNumBins];
+	float binLevel_dB[kNumBins];
+
+	double bandSampleRate = 0.0;
+	uint32_t bandFirstBin[kNumBands] = { 0 };
+	uint32_t bandLastBin[kNumBands] = { 0 };		///< inclusive; first > last marks a band above Nyquist
+	float bandCentre[kNumBands] = { 0.0f };
+	float smoothed_dB[2][kNumBands] = { { 0.0f } };
+	float riseCoeff = 0.0f;
+	float fallCoeff = 0.0f;
+	uint32_t sequence = 0;
+
+	void run()
+	{
+		SpectrumCaptureBlock block;
+		while (running.load())
+		{
+			// --- sleep until capturePost( ) commits a block; the timeout only covers a missed wakeup
+			if (!ring.pop(block))
+			{
+				wakeup.wait(std::chrono::milliseconds(50));
+				continue;
+			}
+
+			double rate = sampleRate.load(std::memory_order_relaxed);
+			if (rate != bandSampleRate)
+				buildBands(rate);
+
+			for (uint32_t i = 0; i < block.numFrames; i++)
+			{
+				history[0][writePosition] = 0.5f * (block.preL[i] + block.preR[i]);
+				history[1][writePosition] = 0.5f * (block.postL[i] + block.postR[i]);
+				writePosition = (writePosition + 1) & (kFFTSize - 1);
+
+				if (++samplesSinceFFT == kHopSize)
+				{
+					samplesSinceFFT = 0;
+					analyze();
+				}
+			}
+		}
+	}
+
+	/** map FFT bins to 1/12-octave bands and set the ballistics for the hop rate */
+	void buildBands(double rate)
+	{
+		bandSampleRate = rate;
+		double binWidth = rate / kFFTSize;
+		for (uint32_t band = 0; band < kNumBands; band++)
+		{
+			double low = 20.0 * pow(2.0, band / 12.0);
+			double high = 20.0 * pow(2.0, (band + 1) / 12.0);
+			bandCentre[band] = (float)sqrt(low * high);
+
+			// --- bins whose centre lies in [low, high); a band narrower than a bin uses the nearest one
+			uint32_t first = (uint32_t)ceil(low / binWidth);
+			uint32_t last = (uint32_t)ceil(high / binWidth) - 1;
+			if (first > last)
+				first = last = (uint32_t)(bandCentre[band] / binWidth + 0.5);
+
+			if (low >= 0.5 * rate)
+			{
+				first = 1;
+				last = 0;
+			}
+			bandFirstBin[band] = first;
+			bandLastBin[band] = std::min(last, kNumBins - 1);
+		}
+
+		// --- 20 ms rise, 300 ms fall, applied once per hop
+		double hopTime = kHopSize / rate;
+		riseCoeff = (float)(1.0 - exp(-hopTime / 0.020));
+		fallCoeff = (float)(1.0 - exp(-hopTime / 0.300));
+
+		for (uint32_t tap = 0; tap < 2; tap++)
+			std::fill(smoothed_dB[tap], smoothed_dB[tap] + kNumBands, (float)SpectrumSnapshot::kFloor_dB);
+	}
+
+	/** FFT both taps over the newest kFFTSize samples and publish */
+	void analyze()
+	{
+		SpectrumSnapshot& snapshot = snapshots.getWriteBuffer();
+		for (uint32_t tap = 0; tap < 2; tap++)
+		{
+			// --- oldest sample first
+			for (uint32_t n = 0; n < kFFTSize; n++)
+				frame[n] = history[tap][(writePosition + n) & (kFFTSize - 1)] * window[n];
+
+			fft.forward(frame, re, im);
+			for (uint32_t bin = 0; bin < kNumBins; bin++)
+			{
+				float power = re[bin] * re[bin] + im[bin] * im[bin];
+				binLevel_dB[bin] = power > 0.0f ? 10.0f * log10f(power) + magnitudeScale_dB : SpectrumSnapshot::kFloor_dB;
+			}
+
+			float* output = tap == 0 ? snapshot.pre_dB : snapshot.post_dB;
+			for (uint32_t band = 0; band < kNumBands; band++)
+			{
+				float level = SpectrumSnapshot::kFloor_dB;
+				for (uint32_t bin = bandFirstBin[band]; bin <= bandLastBin[band]; bin++)
+					level = std::max(level, binLevel_dB[bin]);
+
+				float& state = smoothed_dB[tap][band];
+				state += (level > state ? riseCoeff : fallCoeff) * (level - state);
+				output[band] = std::max(state, (float)SpectrumSnapshot::kFloor_dB);
+			}
+		}
+
+		std::copy(bandCentre, bandCentre + kNumBands, snapshot.frequency_Hz);
+		snapshot.sequence = ++sequence;
+		snapshots.publish();
+	}
+};
+
+#endif